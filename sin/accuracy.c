@@ -0,0 +1,135 @@
+#include <stdio.h>
+#include <math.h>
+
+#include "accuracy.h"
+#include "mysin.h"
+
+// The reference follows sin_5 in double-double.  phReduce brings x
+// down to |r| <= Pi/4 with about 106 good bits, |r| is split into the
+// nearest of 257 nodes k*Pi/1024 and a remainder d, |d| <= Pi/2048, and
+//
+//     Sin(node + d) = Sin(node)*Cos(d) + Cos(node)*Sin(d)
+//     Cos(node + d) = Cos(node)*Cos(d) - Sin(node)*Sin(d)
+//
+// with the node values from dd_sincos_taylor and Sin(d), Cos(d) from
+// their Taylor series.  Past d^5 the terms are below 2^-60 of the sum,
+// so they are summed in double.
+
+#define REF_NODES 256
+
+static dd node[REF_NODES + 1];
+static dd node_sin[REF_NODES + 1];
+static dd node_cos[REF_NODES + 1];
+static dd inv_fact[8];          // 1/n!, n = 2..7, as double-doubles
+
+void acc_init(void) {
+  for (int k = 0; k <= REF_NODES; k++) {
+    node[k] = dd_mul_d(dd_pi, (double)k / (4.0 * REF_NODES));
+    dd_sincos_taylor(node[k], &node_sin[k], &node_cos[k]);
+  }
+  dd f = dd_make(1.0, 0.0);
+  for (int n = 2; n < 8; n++) {
+    f = dd_mul_d(f, n);
+    inv_fact[n] = dd_div(dd_make(1.0, 0.0), f);
+  }
+}
+
+void sincos_ref(double x, dd *s, dd *c) {
+  if (!isfinite(x)) {
+    *s = *c = dd_make(x - x, 0.0);
+    return;
+  }
+  double hi, lo;
+  int n = phReduce(x, &hi, &lo);
+  dd r = two_sum(hi, lo);
+  int neg_r = r.hi < 0.0;
+  if (neg_r) r = dd_neg(r);
+
+  int k = (int)(r.hi * (4.0 * REF_NODES / M_PI) + 0.5);
+  if (k > REF_NODES) k = REF_NODES;
+  dd d = dd_sub(r, node[k]);
+  dd d2 = dd_mul(d, d);
+  double z = d2.hi;
+
+  // Sin(d) = d - d^3/3! + d^5/5! - ..., Cos(d) = 1 - d^2/2! + d^4/4! - ...
+  double st = z * (-1.0 / 5040 + z * (1.0 / 362880 - z * (1.0 / 39916800)));
+  double ct = z * (-1.0 / 720 + z * (1.0 / 40320 - z * (1.0 / 3628800)));
+  dd ps = dd_sub(dd_mul(d2, dd_add_d(inv_fact[5], st)), inv_fact[3]);
+  dd pc = dd_sub(dd_mul(d2, dd_add_d(inv_fact[4], ct)), inv_fact[2]);
+  dd sd = dd_add(d, dd_mul(dd_mul(d, d2), ps));
+  dd cd = dd_add_d(dd_mul(d2, pc), 1.0);
+
+  dd sr = dd_add(dd_mul(node_sin[k], cd), dd_mul(node_cos[k], sd));
+  dd cr = dd_sub(dd_mul(node_cos[k], cd), dd_mul(node_sin[k], sd));
+  if (neg_r) sr = dd_neg(sr);
+
+  // x = n*Pi/2 + r
+  switch (n & 3) {
+  case 0: *s = sr;         *c = cr;         break;
+  case 1: *s = cr;         *c = dd_neg(sr); break;
+  case 2: *s = dd_neg(sr); *c = dd_neg(cr); break;
+  case 3: *s = dd_neg(cr); *c = sr;         break;
+  }
+}
+
+dd sin_ref(double x) {
+  dd s, c;
+  sincos_ref(x, &s, &c);
+  return s;
+}
+
+double ulp_error(double y, dd exact, int mant_bits) {
+  if (isnan(y) || isnan(exact.hi)) {
+    return isnan(y) && isnan(exact.hi) ? 0.0 : INFINITY;
+  }
+  // The exponent of the exact value, which is below that of hi when hi
+  // is a power of two and lo pulls the other way.
+  double a = fabs(exact.hi);
+  int e = ilogb(a);
+  if (a == ldexp(1.0, e) && (exact.lo < 0.0) != (exact.hi < 0.0) && exact.lo != 0.0) {
+    e--;
+  }
+  int min_e = mant_bits == 24 ? -126 : -1022;
+  if (exact.hi == 0.0 || e < min_e) e = min_e;
+  double ulp = ldexp(1.0, e - (mant_bits - 1));
+  // y - hi is exact when y is near the answer; far off it doesn't matter
+  return fabs((y - exact.hi) - exact.lo) / ulp;
+}
+
+void acc_clear(struct acc_stats *a, int mant_bits) {
+  *a = (struct acc_stats){0};
+  a->mant_bits = mant_bits;
+}
+
+void acc_merge(struct acc_stats *into, const struct acc_stats *a) {
+  if (a->n == 0) return;
+  if (into->n == 0 || a->max > into->max) {
+    into->max = a->max;
+    into->worst_x = a->worst_x;
+  }
+  into->n += a->n;
+  into->sum += a->sum;
+  for (int b = 0; b < ACC_BINS; b++) {
+    into->hist[b] += a->hist[b];
+  }
+}
+
+void acc_print(FILE *out, const struct acc_stats *a) {
+  fprintf(out, "%12s %llu\n", "points", (unsigned long long)a->n);
+  fprintf(out, "%12s %.4f ulp\n", "mean", a->n ? a->sum / a->n : 0.0);
+  fprintf(out, "%12s %.4f ulp\n", "max", a->max);
+  fprintf(out, "%12s %+-.17e (%a)\n", "worst x", a->worst_x, a->worst_x);
+  fprintf(out, "%12s\n", "histogram");
+  for (int b = 0; b < ACC_BINS; b++) {
+    if (a->hist[b] == 0) continue;
+    double lo = b < ACC_FINE_BINS ? (double)b / ACC_FINE_BINS : ldexp(1.0, b - ACC_FINE_BINS);
+    double hi = b < ACC_FINE_BINS ? (double)(b + 1) / ACC_FINE_BINS : 2.0 * lo;
+    if (b == ACC_BINS - 1) {
+      fprintf(out, "%12s >= %-8g %14llu %10.6f%%\n", "", lo,
+              (unsigned long long)a->hist[b], 100.0 * a->hist[b] / a->n);
+    } else {
+      fprintf(out, "%12s %8g - %-8g %10llu %10.6f%%\n", "", lo, hi,
+              (unsigned long long)a->hist[b], 100.0 * a->hist[b] / a->n);
+    }
+  }
+}
@@ -0,0 +1,67 @@
+// accuracy.h
+// Errors in ulp against an in-tree reference.
+//
+// sincos_ref gives Sin(x) and Cos(x) as double-doubles, good to about
+// 2^-100 relative for every finite double, so rounding them gives the
+// correctly rounded result in all but the hardest cases, and the error
+// of a kernel can be measured to a small fraction of an ulp.
+// acc_add compares one result against it and keeps the count, mean,
+// max, worst argument and a histogram; acc_merge adds up the stats of
+// separate threads.
+
+#ifndef ACCURACY_H
+#define ACCURACY_H
+
+#include <stdint.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "dd.h"
+
+// Build the tables; call once before anything else here.
+void acc_init(void);
+void sincos_ref(double x, dd *s, dd *c);
+dd sin_ref(double x);
+
+// |y - exact| in ulps of the exact value, at a precision of mant_bits
+// (53 for double, 24 for float).  Infinity if one is NaN and the other
+// is not; 0 if both are.
+double ulp_error(double y, dd exact, int mant_bits);
+
+// Histogram bins: [0, 0.1), ..., [0.9, 1) ulp, then [1, 2), [2, 4),
+// ... [2^19, 2^20), then everything above.
+#define ACC_FINE_BINS 10
+#define ACC_BINS (ACC_FINE_BINS + 21)
+
+struct acc_stats {
+  int           mant_bits;
+  uint64_t      n;
+  double        sum;            // of the ulp errors, for the mean
+  double        max;
+  double        worst_x;
+  uint64_t      hist[ACC_BINS];
+};
+
+void acc_clear(struct acc_stats *a, int mant_bits);
+// Inf and NaN errors, from kernels that return them at finite x, go
+// above the rest; ilogb has no bin for them.
+static inline int acc_bin(double e) {
+  if (e < 1.0) return (int)(e * ACC_FINE_BINS);
+  if (!(e < INFINITY)) return ACC_BINS - 1;
+  int b = ACC_FINE_BINS + ilogb(e);
+  return b >= ACC_BINS ? ACC_BINS - 1 : b;
+}
+static inline void acc_add(struct acc_stats *a, double x, double y, dd exact) {
+  double e = ulp_error(y, exact, a->mant_bits);
+  a->n++;
+  a->sum += e;
+  if (e > a->max || a->n == 1) {
+    a->max = e;
+    a->worst_x = x;
+  }
+  a->hist[acc_bin(e)]++;
+}
+void acc_merge(struct acc_stats *into, const struct acc_stats *a);
+void acc_print(FILE *out, const struct acc_stats *a);
+
+#endif
@@ -1,9 +1,14 @@
+#include <stdint.h>
+#include <string.h>
+
 #include <gsl/gsl_math.h>
 
+#include "variant.h"
+
 // This extracts the angle-reduction logic from
 // gsl_sf_sin in the specfunc/trig.c file from GSL.
 
-double gslReduceBase(double x) {
+static double gslReduceBase(double x) {
   const double P1 = 7.85398125648498535156e-1;
   const double P2 = 3.77489470793079817668e-8;
   const double P3 = 2.69515142907905952645e-15;
@@ -25,3 +30,259 @@ double gslReduce(double x) {
   y = (y + 1)*M_PI_4/2;
   return y;
 }
+
+// Pi/2 split into three doubles, 2/Pi, and 1.5*2^52 for rounding to
+// an integer by addition.
+static const double PiD2_1 = 1.57079632679489655800e+00;   // 0x1.921fb54442d18p+0
+static const double PiD2_2 = 6.12323399573676603587e-17;   // 0x1.1a62633145c07p-54
+static const double PiD2_3 = -1.49738490485916983294e-33;  // -0x1.f1976b7ed8fbcp-110
+static const double TwoDPi = 6.36619772367581382433e-01;   // 0x1.45f306dc9c883p-1
+static const double ToInt = 6755399441055744.0;            // 0x1.8p52
+
+// Cody-Waite reduction for |x| < 2^20, after reduce_sincos in glibc.
+//
+// n = round(x * 2/Pi) comes from adding 1.5*2^52, which leaves n in
+// the low bits of the sum, so there is no divide and no rounding
+// instruction.  Then x - n*Pi/2 is taken off one piece of Pi/2 at a
+// time.  PiD2_1 has a full 53 bit significand, but with |n| < 2^20 the
+// fused x - n*PiD2_1 is exact anyway; n*PiD2_2 is split exactly with
+// another FMA and subtracted with an error-free two-sum, and the last
+// piece only touches the low word.  sin3.s and reduce.s run the same
+// instructions inline.
+//
+// Returns the quadrant n (mod 4) with x = n*Pi/2 + (*hi + *lo) and
+// |*hi + *lo| <= Pi/4 (plus a rounding).
+
+int cwReduce(double x, double *hi, double *lo) {
+  double t = fma(x, TwoDPi, ToInt);
+  uint64_t bits;
+  memcpy(&bits, &t, sizeof(bits));
+  double n = t - ToInt;
+
+  double r = fma(-n, PiD2_1, x);      // exact
+  double p = n * PiD2_2;
+  double pe = fma(n, PiD2_2, -p);     // n*PiD2_2 = p + pe
+  double h = r - p;
+  double bb = h - r;
+  double e = (r - (h - bb)) - (p + bb);
+
+  *hi = h;
+  *lo = fma(-n, PiD2_3, e - pe);
+  return bits & 3;
+}
+
+// Payne-Hanek reduction for huge arguments, after __branred in
+// glibc and LargeRangeReduction in LLVM libc.
+//
+// Write |x| = m * 2^e with m a 53 bit integer.  Then
+//
+//     x * 2/Pi = m * 2^e * sum(b[j] * 2^-(j+1))
+//
+// where b[j] are the bits of 2/Pi.  Every bit with j <= e - 3 adds a
+// multiple of 4 and so drops out of the quadrant, and bits far enough
+// past the binary point can't change the result.  So we take a 256 bit
+// window of 2/Pi starting at bit e - 2, multiply it by m in integer
+// arithmetic, and read the quadrant and the fraction straight out of
+// the product.  No divide, and no bits are lost however big x is.
+//
+// Returns the quadrant n (mod 4) with x = n*Pi/2 + (*hi + *lo) and
+// |*hi + *lo| <= Pi/4.
+
+// 2/Pi = sum(two_over_pi[k] * 2^(-64*(k+1))), 1280 bits.
+static const uint64_t two_over_pi[20] = {
+  0xa2f9836e4e441529ULL, 0xfc2757d1f534ddc0ULL,
+  0xdb6295993c439041ULL, 0xfe5163abdebbc561ULL,
+  0xb7246e3a424dd2e0ULL, 0x06492eea09d1921cULL,
+  0xfe1deb1cb129a73eULL, 0xe88235f52ebb4484ULL,
+  0xe99c7026b45f7e41ULL, 0x3991d639835339f4ULL,
+  0x9c845f8bbdf9283bULL, 0x1ff897ffde05980fULL,
+  0xef2f118b5a0a6d1fULL, 0x6d367ecf27cb09b7ULL,
+  0x4f463f669e5fea2dULL, 0x7527bac7ebe5f17bULL,
+  0x3d0739f78a5292eaULL, 0x6bfb5fb11f8d5d08ULL,
+  0x56033046fc7b6babULL, 0xf0cfbc209af4361dULL
+};
+
+
+// 64 bits of 2/Pi starting at bit s, where bit 0 is worth 1/2.
+// Bits before the binary point are zero.
+uint64_t two_over_pi_bits(int s) {
+  const int n = sizeof(two_over_pi) / sizeof(two_over_pi[0]);
+  if (s <= -64) return 0;
+  if (s < 0) return two_over_pi[0] >> -s;
+  int w = s >> 6;
+  int b = s & 63;
+  uint64_t hi = w < n ? two_over_pi[w] : 0;
+  if (b == 0) return hi;
+  uint64_t lo = w + 1 < n ? two_over_pi[w + 1] : 0;
+  return (hi << b) | (lo >> (64 - b));
+}
+
+// 2^k for -1022 <= k <= 1023
+static double pow2(int k) {
+  uint64_t bits = (uint64_t)(k + 1023) << 52;
+  double d;
+  memcpy(&d, &bits, sizeof(d));
+  return d;
+}
+
+// |x|*2/Pi for finite |x| > Pi/4: returns the nearest integer n, and
+// leaves the rest as a 192 bit binary fraction 0.f0f1f2 * 2^-lz with
+// the leading one at the top of f0, and its sign.  The remainder is
+// Pi/2 times that.  f0 is 0 only if the fraction is, to 192 bits.
+static int ph_fraction(uint64_t ix, uint64_t f[3], int *lz, int *negative) {
+  const int biased = (ix >> 52) & 0x7ff;
+
+  // |x| = m * 2^e
+  const uint64_t m = (ix & 0x000fffffffffffffULL) | 0x0010000000000000ULL;
+  const int e = biased - 1075;
+
+  // v = m * (256 bits of 2/Pi from bit e - 2).  The binary point of
+  // the product sits 254 bits up, so the quadrant is in the top two
+  // bits of v1 and the fraction follows it.
+  const int s = e - 2;
+  unsigned __int128 p;
+  uint64_t v1, v2, v3, v4;
+  p = (unsigned __int128)m * two_over_pi_bits(s + 192);
+  v4 = (uint64_t)p;
+  p = (unsigned __int128)m * two_over_pi_bits(s + 128) + (p >> 64);
+  v3 = (uint64_t)p;
+  p = (unsigned __int128)m * two_over_pi_bits(s + 64) + (p >> 64);
+  v2 = (uint64_t)p;
+  p = (unsigned __int128)m * two_over_pi_bits(s) + (p >> 64);
+  v1 = (uint64_t)p;
+
+  // Round to the nearest quadrant.  Read as a signed 192 bit number the
+  // fraction f0.f1f2 is already the residual in [-1/2, 1/2).
+  int n = (int)(v1 >> 62);
+  uint64_t f0 = (v1 << 2) | (v2 >> 62);
+  uint64_t f1 = (v2 << 2) | (v3 >> 62);
+  uint64_t f2 = (v3 << 2) | (v4 >> 62);
+  *negative = f0 >> 63;
+  if (*negative) {
+    n += 1;
+    f0 = ~f0; f1 = ~f1; f2 = ~f2;
+    if (++f2 == 0 && ++f1 == 0) ++f0;
+  }
+
+  // Normalize so the leading one is the top bit of f0.
+  *lz = 0;
+  while (f0 == 0 && *lz < 128) {
+    f0 = f1; f1 = f2; f2 = 0;
+    *lz += 64;
+  }
+  int z = f0 == 0 ? 0 : __builtin_clzll(f0);
+  if (z > 0) {
+    f0 = (f0 << z) | (f1 >> (64 - z));
+    f1 = (f1 << z) | (f2 >> (64 - z));
+    f2 <<= z;
+    *lz += z;
+  }
+  f[0] = f0;
+  f[1] = f1;
+  f[2] = f2;
+  return n;
+}
+
+int phReduce(double x, double *hi, double *lo) {
+  uint64_t ix;
+  memcpy(&ix, &x, sizeof(ix));
+  const int sign = ix >> 63;
+  const int biased = (ix >> 52) & 0x7ff;
+
+  if (biased == 0x7ff) {        // Inf or NaN
+    *hi = x - x;
+    *lo = 0.0;
+    return 0;
+  }
+  if (fabs(x) <= M_PI_4) {      // already reduced
+    *hi = x;
+    *lo = 0.0;
+    return 0;
+  }
+
+  uint64_t f[3];
+  int lz, negative;
+  int n = ph_fraction(ix, f, &lz, &negative);
+  if (f[0] == 0) {
+    *hi = *lo = 0.0;
+    return sign ? -n & 3 : n & 3;
+  }
+
+  // The fraction as a double-double, then times Pi/2.
+  double fh = (double)(f[0] >> 11) * pow2(-53 - lz);
+  double fl = (double)((f[0] << 53) | (f[1] >> 11)) * pow2(-117 - lz);
+  double t = fh + fl;
+  fl = fl - (t - fh);
+  fh = t;
+
+  double rh = fh * PiD2_1;
+  double rl = fma(fh, PiD2_1, -rh) + (fh * PiD2_2 + fl * PiD2_1);
+  t = rh + rl;
+  rl = rl - (t - rh);
+  rh = t;
+
+  if (negative != sign) {
+    rh = -rh;
+    rl = -rl;
+  }
+  *hi = rh;
+  *lo = rl;
+  return sign ? -n & 3 : n & 3;
+}
+
+// Pi/2 = PiD2_128 * 2^-127, rounded down
+static const unsigned __int128 PiD2_128 =
+  (unsigned __int128)0xc90fdaa22168c234ULL << 64 | 0xc4c6628b80dc1cd1ULL;
+
+int phReduce128(double x, int *neg, unsigned __int128 *r, int *exp) {
+  uint64_t ix;
+  memcpy(&ix, &x, sizeof(ix));
+  const int sign = ix >> 63;
+  const int biased = (ix >> 52) & 0x7ff;
+
+  *neg = sign;
+  if (biased == 0x7ff || x == 0.0) {
+    *r = 0;
+    *exp = 0;
+    return 0;
+  }
+  if (fabs(x) <= M_PI_4) {      // already reduced, and exact
+    int e;
+    double m = frexp(fabs(x), &e);
+    *r = (unsigned __int128)(uint64_t)ldexp(m, 64) << 64;
+    *exp = e - 1;
+    return 0;
+  }
+
+  uint64_t f[3];
+  int lz, negative;
+  int n = ph_fraction(ix, f, &lz, &negative);
+  *neg = negative != sign;
+  if (f[0] == 0) {
+    *r = 0;
+    *exp = 0;
+    return sign ? -n & 3 : n & 3;
+  }
+
+  // 0.f0f1 * Pi/2, the top 128 bits of the 256 bit product
+  uint64_t a[2] = {f[0], f[1]};
+  uint64_t b[2] = {(uint64_t)(PiD2_128 >> 64), (uint64_t)PiD2_128};
+  unsigned __int128 hh = (unsigned __int128)a[0] * b[0];
+  unsigned __int128 hl = (unsigned __int128)a[0] * b[1];
+  unsigned __int128 lh = (unsigned __int128)a[1] * b[0];
+  unsigned __int128 ll = (unsigned __int128)a[1] * b[1];
+  unsigned __int128 mid = (hl & UINT64_MAX) + (lh & UINT64_MAX) + (ll >> 64);
+  unsigned __int128 top = hh + (hl >> 64) + (lh >> 64) + (mid >> 64);
+
+  // 0.f0f1 is in [1/2, 1) and Pi/2 in [1, 2), so the product is in
+  // [1/2, 2): top has its leading one at bit 127 or bit 126.
+  int e = -1 - lz;
+  if (top >> 127) {
+    e += 1;
+  } else {
+    top = top << 1 | ((uint64_t)mid >> 63);
+  }
+  *r = top;
+  *exp = e;
+  return sign ? -n & 3 : n & 3;
+}
@@ -3,6 +3,7 @@
 #include <time.h>
 #include <string.h>
 #include <unistd.h>
+#include <math.h>
 
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_randist.h>
@@ -11,11 +12,19 @@
 #include <gsl/gsl_statistics_double.h>
 
 #include "mysin.h"
+#include "functions.h"
+#include "timing.h"
+#include "perfcount.h"
+#include "results.h"
+#include "distrib.h"
+#include "accuracy.h"
 
 char* help_string =
   "benchmark - Timing program for sin functions.\n"
   "usage: benchmark [-h]\n"
-  "       benchmark [-p npoints] [-c ncycles] [-m min -M max]\n"
+  "       benchmark [-p npoints] [-c ncycles] [-m min -M max] [-b] [-C block] [-S]\n"
+  "                 [-w warmup] [-r min,max] [-e ci] [-P cpu] [-G ghz] [-l | -T]\n"
+  "                 [-D distribution]... [-O order] [-H] [-F format] [-K kernels]\n"
   "       benchmark -x value\n\n"
   "    -p npoints          The number of x values to use for each cycle of testing\n"
   "                        Default 10000\n"
@@ -23,108 +32,371 @@ char* help_string =
   "                        Default 3\n"
   "    -m min -M max       Specify a range from which to draw x values for testing Sin(x).\n"
   "                        Defaults min=-Pi max=Pi\n"
+  "    -D distribution     How to draw them: flat (uniform), log[:lo,hi] (2^e,\n"
+  "                        e uniform), halfpi[:lo,hi] (k*Pi/2 +- 2^e), sweep\n"
+  "                        (evenly spaced), file:path (raw doubles, replayed)\n"
+  "                        or special (zeros, subnormals, tiny, near k*Pi/2,\n"
+  "                        huge, Inf, NaN and flat).  log ignores the range.\n"
+  "                        Repeat -D to time and check each in turn.\n"
+  "                        Default flat\n"
   "    -A fname            Choose functions to test by name.\n"
   "    -B fname            \n"
-  "    -L                  List available functions.\n"
+  "    -b                  Time function A through its batch (array) entry point,\n"
+  "                        function B through the scalar loop.  -A sin3 -B sin3 -b\n"
+  "                        compares the two ways of calling the same kernel.\n"
+  "    -C block            Cold cache: flush the data caches before every block\n"
+  "                        of calls, so tables and constants come from memory.\n"
+  "                        Only the calls are timed.  Default hot cache.\n"
+  "    -S                  Time sincos_3 (sincos_3_batch with -b) as function A\n"
+  "                        against two calls of function B, at x and x + Pi/2.\n"
+  "                        Times count (Sin, Cos) pairs, errors cover both;\n"
+  "                        B's Cos is scored as its Sin at the rounded x + Pi/2.\n"
+  "    -w warmup           Untimed passes over the points before timing.\n"
+  "                        Default 2\n"
+  "    -r min,max          Timed passes per cycle: at least min, then more until\n"
+  "                        the 95% confidence interval is within -e of the mean,\n"
+  "                        at most max.  Default 5,100\n"
+  "    -e ci               Relative half-width of the confidence interval to aim\n"
+  "                        for.  Default 0.01\n"
+  "    -P cpu              Run on this CPU (Linux); on macOS any value asks for\n"
+  "                        the performance cores.  Default not pinned.\n"
+  "    -G ghz              CPU clock, to turn ns into cycles.  Default the TSC\n"
+  "                        rate on x86-64; on arm64 cycles are only shown with -G.\n"
+  "    -l                  Latency: each call's argument waits on the result of\n"
+  "                        the call before (x[i] +- 0), as in a feedback\n"
+  "                        loop.  Batch entry points are not used.  Default\n"
+  "                        throughput, independent calls.\n"
+  "    -O order            random, sorted or constant: the points as drawn,\n"
+  "                        sorted ascending, or all equal to the first.  Shows\n"
+  "                        what branch prediction does for a kernel.  Default\n"
+  "                        random\n"
+  "    -H                  Also count cycles, instructions, branch misses, L1D\n"
+  "                        misses and divider-busy cycles per call with the\n"
+  "                        hardware counters (Linux perf_event_open), for\n"
+  "                        each function timed.  Counters the system won't give\n"
+  "                        show as n/a.\n"
+  "    -F format           table, json or csv.  json and csv carry every field\n"
+  "                        of the table, with full precision, and the host, CPU\n"
+  "                        and settings of the run; compare reads the csv.\n"
+  "                        json gives one object per distribution.\n"
+  "                        -T always prints a table.  Default table\n"
+  "    -T                  Time every function, throughput and latency, over\n"
+  "                        one set of points, and print a table.\n"
+  "    -K kernels          Also offer the kernels of these shared objects,\n"
+  "                        separated by ':'; a directory offers all its .so and\n"
+  "                        .dylib files that have them.  See kernel.h.\n"
+  "                        Default $MYSIN_KERNELS\n"
+  "    -L                  List available functions.  When either function is\n"
+  "                        single precision (float), x values are rounded to float\n"
+  "                        for both.\n"
   "    -x value            Calculate both functions only at x=value\n"
-  "    -h                  Display this help.\n";
+  "    -h                  Display this help.\n\n"
+  "Errors are in ulp against the double-double reference in accuracy.c,\n"
+  "float ulps for single precision functions; see ulp for more points.\n";
 
-typedef double (*f_ptr)(double);
+void print_stats(struct benchCycle *stats, int cycles) {
+  printf("%5s %12s %12s %12s %12s %12s %12s %12s %10s %10s %12s %10s %10s\n",
+         "cycle", "N points", "min x", "max x", "mean ulp A",
+         "max ulp A", "max ulp B", "ns/call A", "+-", "cyc A",
+         "ns/call B", "+-", "cyc B");
+  for (int c = 0; c < cycles; c++) {
+    printf("%5d %12ld %12e %12e %12.4g %12.4g %12.4g %12.3f %10.3f %10.2f %12.3f %10.3f %10.2f\n",
+           c,
+           stats[c].points,
+           stats[c].minx,
+           stats[c].maxx,
+           stats[c].mean_err,
+           stats[c].max_err,
+           stats[c].max_err_B,
+           stats[c].time_A.ns,
+           stats[c].time_A.ns_ci,
+           stats[c].time_A.cycles,
+           stats[c].time_B.ns,
+           stats[c].time_B.ns_ci,
+           stats[c].time_B.cycles);
+  }
+}
 
-struct function_item {
-  const char*   f_name;
-  f_ptr         f_ptr;
-};
+// Cold-cache runs write over a buffer bigger than the data caches
+// between blocks of calls.
+#define EVICT_BYTES (32 << 20)
+static char *evict_buffer;
 
-struct function_item function_lookup[] = {
-  {"sin1",      &sin_1},
-  {"sin2",      &sin_2},
-  {"sin3",      &sin_3},
-  {"gslsin",    &gsl_sf_sin},
-  {"reduce",    &reduce},
-  {"gslReduce", &gslReduce},
-  {"",          NULL}
-};
+void evict_caches() {
+  for (size_t i = 0; i < EVICT_BYTES; i += 64) {
+    evict_buffer[i]++;
+  }
+}
 
-struct benchCycle {
-  long          points;
-  double        minx;
-  double        maxx;
-  double        mean_err;
-  double        min_err;
-  double        max_err;
-  double        ops_per_sec_A;
-  double        ops_per_sec_B;
-};
+// Float copies of x and y for the single precision functions, so the
+// conversions stay outside the timed calls.
+static float *xf, *yf;
+static int xf_points;
 
-void list_functions() {
-  fprintf(stderr, "Available function options:\n");
-  for(int i = 0; function_lookup[i].f_ptr != NULL; i++) {
-    fprintf(stderr, "\t%s\n", function_lookup[i].f_name);
+static int float_buffers(int points) {
+  if (points > xf_points) {
+    free(xf);
+    free(yf);
+    xf = malloc(points * sizeof(float));
+    yf = malloc(points * sizeof(float));
+    xf_points = (xf == NULL || yf == NULL) ? 0 : points;
   }
+  return xf_points >= points;
 }
 
-f_ptr get_function(const char *f_name) {
-  f_ptr f = NULL;
-  int i = 0;
-  for(int i = 0; function_lookup[i].f_ptr != NULL; i++) {
-    if( 0 == strcmp(f_name, function_lookup[i].f_name) ) {
-      if( (f = function_lookup[i].f_ptr) == NULL ) break;
+// Ticks to compute y[i] = f(x[i]) for i < points, through the batch
+// entry point if f has one.  With block > 0 the caches are flushed
+// before each block of calls and only the calls are counted.
+//
+// With chain set each call waits for the one before: its argument is
+// x[i] plus a zero with the sign of y[i-1], the same value, but not
+// known until y[i-1] is.  (0*y[i-1] would turn every argument after a
+// NaN or Inf result into NaN.)  That measures latency rather than
+// throughput, plus the copysign and add of the chain itself.  Batch
+// entry points can't be chained, so chain always goes through the
+// scalar function.
+uint64_t time_function(struct function_item *f, const double *x, double *y,
+                       int points, int block, int chain) {
+  uint64_t begin;
+  uint64_t spent = 0;
+  int single = f->ff_ptr != NULL;
+  if (single) {
+    if (!float_buffers(points)) {
+      fprintf(stderr, "Unable to allocate memory.");
+      exit(1);
+    }
+    for (int i = 0; i < points; i++) {
+      xf[i] = (float)x[i];
+    }
+  }
+  if (block <= 0) block = points;
+  for (int i0 = 0; i0 < points; i0 += block) {
+    int n = points - i0 < block ? points - i0 : block;
+    if (block < points) evict_caches();
+    begin = timer_ticks();
+    if (chain && single) {
+      float prev = 0.0f;
+      for (int i = i0; i < i0 + n; i++) {
+        yf[i] = prev = f->ff_ptr(xf[i] + copysignf(0.0f, prev));
+      }
+    } else if (chain) {
+      double prev = 0.0;
+      for (int i = i0; i < i0 + n; i++) {
+        y[i] = prev = f->f_ptr(x[i] + copysign(0.0, prev));
+      }
+    } else if (single && f->fbatch_ptr != NULL) {
+      f->fbatch_ptr(xf + i0, yf + i0, n);
+    } else if (single) {
+      for (int i = i0; i < i0 + n; i++) {
+        yf[i] = f->ff_ptr(xf[i]);
+      }
+    } else if (f->batch_ptr != NULL) {
+      f->batch_ptr(x + i0, y + i0, n);
+    } else {
+      for (int i = i0; i < i0 + n; i++) {
+        y[i] = f->f_ptr(x[i]);
+      }
+    }
+    spent += timer_elapsed(begin);
+  }
+  if (single) {
+    for (int i = 0; i < points; i++) {
+      y[i] = yf[i];
     }
   }
-  return f;
+  return spent;
 }
 
-void print_stats(struct benchCycle *stats, int cycles) {
-  printf("%5s %12s %12s %12s %12s %12s %12s %12s %12s\n",
-         "cycle", "N points", "min x", "max x", "mean(err)",
-         "min(err)", "max(err)", "op/sec A", "op/sec B");
-  for (int c = 0; c < cycles; c++) {
-    printf("%5d %12ld %12e %12e %12e %12e %12e %12e %12e\n",
-           c,
-           stats[c].points,
-           stats[c].minx,
-           stats[c].maxx,
-           stats[c].mean_err,
-           stats[c].min_err,
-           stats[c].max_err,
-           stats[c].ops_per_sec_A,
-           stats[c].ops_per_sec_B);
+// The same for both halves of the Sin and Cos pair: sincos_3 (or
+// sincos_3_batch) with f == NULL, otherwise two calls of f.  Chained,
+// each pair waits for the Cos of the pair before.
+uint64_t time_sincos(struct function_item *f, int batch, const double *x,
+                     double *s, double *c, int points, int block, int chain) {
+  uint64_t begin;
+  uint64_t spent = 0;
+  if (block <= 0) block = points;
+  for (int i0 = 0; i0 < points; i0 += block) {
+    int n = points - i0 < block ? points - i0 : block;
+    if (block < points) evict_caches();
+    begin = timer_ticks();
+    if (chain && f != NULL) {
+      double prev = 0.0;
+      for (int i = i0; i < i0 + n; i++) {
+        double xi = x[i] + copysign(0.0, prev);
+        s[i] = f->f_ptr(xi);
+        c[i] = prev = f->f_ptr(xi + M_PI_2);
+      }
+    } else if (chain) {
+      double prev = 0.0;
+      for (int i = i0; i < i0 + n; i++) {
+        sincos_3(x[i] + copysign(0.0, prev), s + i, c + i);
+        prev = c[i];
+      }
+    } else if (f != NULL) {
+      for (int i = i0; i < i0 + n; i++) {
+        s[i] = f->f_ptr(x[i]);
+        c[i] = f->f_ptr(x[i] + M_PI_2);
+      }
+    } else if (batch) {
+      sincos_3_batch(x + i0, s + i0, c + i0, n);
+    } else {
+      for (int i = i0; i < i0 + n; i++) {
+        sincos_3(x[i], s + i, c + i);
+      }
+    }
+    spent += timer_elapsed(begin);
   }
+  return spent;
+}
+
+// One timed pass over the points, for timing_measure.
+struct pass_args {
+  struct function_item *f;      // NULL for sincos_3
+  int           sincos;
+  int           batch;
+  const double *x;
+  double       *y;
+  double       *y_cos;
+  int           points;
+  int           block;
+  int           chain;
+};
+
+uint64_t timed_pass(void *arg) {
+  struct pass_args *a = arg;
+  if (a->sincos) {
+    return time_sincos(a->f, a->batch, a->x, a->y, a->y_cos, a->points, a->block,
+                       a->chain);
   }
+  return time_function(a->f, a->x, a->y, a->points, a->block, a->chain);
+}
 
-void print_stats_old(struct benchCycle *stats, int cycles) {
-  printf("cycle\t    N points\t       min x\t       max x\t    mean(err)\t    min(err)\t    max(err)\t    op/sec A\t    op/sec B\n");
-  for (int c = 0; c < cycles; c++) {
-    printf("%5d\t%12ld\t%12e\t%12e\t%12e\t%12e\t%12e\t%12e\t%12e\n",
-           c,
-           stats[c].points,
-           stats[c].minx,
-           stats[c].maxx,
-           stats[c].mean_err,
-           stats[c].min_err,
-           stats[c].max_err,
-           stats[c].ops_per_sec_A,
-           stats[c].ops_per_sec_B);
+// Hardware counters per call, one row a function, for -H.
+#define COUNTER_PASSES 5
+
+static void print_counter_header(FILE *out) {
+  fprintf(out, "%-12s", "per call");
+  for (int i = 0; i < PERF_COUNTERS; i++) fprintf(out, " %10s", perf_names[i]);
+  fprintf(out, " %10s\n", "IPC");
+}
+
+static void print_counter_row(FILE *out, const char *name, struct pass_args *pass) {
+  struct perf_counts c;
+  perf_measure(timed_pass, pass, pass->points, COUNTER_PASSES, &c);
+  fprintf(out, "%-12s", name);
+  for (int i = 0; i < PERF_COUNTERS; i++) {
+    if (isnan(c.per_call[i])) {
+      fprintf(out, " %10s", "n/a");
+    } else {
+      fprintf(out, " %10.3f", c.per_call[i]);
+    }
+  }
+  double ipc = c.per_call[PERF_INSTRUCTIONS] / c.per_call[PERF_CYCLES];
+  if (isnan(ipc)) {
+    fprintf(out, " %10s\n", "n/a");
+  } else {
+    fprintf(out, " %10.2f\n", ipc);
+  }
+}
+
+// Throughput and latency of every function in function_lookup, over
+// one set of points.
+void print_all_functions(const double *x, double *y, int points, int block,
+                         int batch, const struct timing_opts *topts, int counters) {
+  printf("%-12s %12s %10s %10s %12s %10s %10s\n", "function",
+         "thru ns", "+-", "thru cyc", "lat ns", "+-", "lat cyc");
+  for (int i = 0; function_lookup[i].f_ptr != NULL; i++) {
+    struct function_item f = function_lookup[i];
+    if (!batch) {
+      f.batch_ptr = NULL;
+      f.fbatch_ptr = NULL;
+    }
+    struct pass_args pass = {&f, 0, batch, x, y, NULL, points, block, 0};
+    struct timing thru, lat;
+    timing_measure(timed_pass, &pass, points, topts, &thru);
+    pass.chain = 1;
+    timing_measure(timed_pass, &pass, points, topts, &lat);
+    printf("%-12s %12.3f %10.3f %10.2f %12.3f %10.3f %10.2f\n", f.f_name,
+           thru.ns, thru.ns_ci, thru.cycles, lat.ns, lat.ns_ci, lat.cycles);
+  }
+  if (!counters) return;
+  printf("\n");
+  print_counter_header(stdout);
+  for (int i = 0; function_lookup[i].f_ptr != NULL; i++) {
+    struct function_item f = function_lookup[i];
+    if (!batch) {
+      f.batch_ptr = NULL;
+      f.fbatch_ptr = NULL;
+    }
+    struct pass_args pass = {&f, 0, batch, x, y, NULL, points, block, 0};
+    print_counter_row(stdout, f.f_name, &pass);
   }
 }
 
+// The calls of sin_cr on the points that failed Ziv's test and took
+// the slow path, from its counters around one untimed pass.
+static uint64_t sin_cr_slow_calls(const double *x, double *y, int points) {
+  uint64_t before, after, undecided;
+  sin_cr_counts(&before, &undecided);
+  for (int i = 0; i < points; i++) y[i] = sin_cr(x[i]);
+  sin_cr_counts(&after, &undecided);
+  return after - before;
+}
+
 gsl_rng *r; /* global random number generator */
 
+enum { ORDER_RANDOM, ORDER_SORTED, ORDER_CONSTANT };
+static const char *order_names[] = {"random", "sorted", "constant"};
+
+enum { FORMAT_TABLE, FORMAT_JSON, FORMAT_CSV };
+static const char *format_names[] = {"table", "json", "csv"};
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// Draw the points from dist, then arrange them.
+static void fill_points(double *x, int points, struct distrib *dist, double min_x,
+                        double max_x, int order) {
+  dist_fill(dist, r, x, points, min_x, max_x);
+  if (order == ORDER_SORTED) {
+    qsort(x, points, sizeof(double), compare_doubles);
+  } else if (order == ORDER_CONSTANT) {
+    for (int i = 1; i < points; i++) x[i] = x[0];
+  }
+}
+
+#define MAX_DISTRIBS 8
+
 int main(int argc, char **argv) {
   int points = 10000;
   int cycles = 3;
   double x_point;
   int single_point = 0;
+  int batch = 0;
+  int cold_block = 0;
+  int sincos = 0;
+  int pin_cpu = -1;
+  int chain = 0;
+  int all_functions = 0;
+  int order = ORDER_RANDOM;
+  int counters = 0;
+  int format = FORMAT_TABLE;
+  int list = 0;
+  const char *kernels = getenv("MYSIN_KERNELS");
+  struct distrib dists[MAX_DISTRIBS];
+  int n_dists = 0;
+  struct timing_opts topts = {2, 5, 100, 0.01, 0.0};
   double min_x = -M_PI;
   double max_x = M_PI;
   struct function_item fA = {
-    "sin3", NULL};
+    "sin3", NULL, NULL, NULL, NULL};
   struct function_item fB = {
-    "gslsin", NULL};
+    "gslsin", NULL, NULL, NULL, NULL};
 
   int c;
-  while ((c = getopt(argc, argv, "c:p:m:M:hA:B:Lx:")) != -1) {
+  while ((c = getopt(argc, argv, "c:p:m:M:hA:B:bC:SLx:w:r:e:P:G:lTO:HF:D:K:")) != -1) {
     switch (c) {
     case 'p':
       points = atoi(optarg);
@@ -147,9 +419,74 @@ int main(int argc, char **argv) {
     case 'B':
       fB.f_name = optarg;
       break;
+    case 'b':
+      batch = 1;
+      break;
+    case 'C':
+      cold_block = atoi(optarg);
+      break;
+    case 'S':
+      sincos = 1;
+      fA.f_name = "sincos3";
+      break;
+    case 'w':
+      topts.warmup = atoi(optarg);
+      break;
+    case 'r':
+      if (sscanf(optarg, "%d,%d", &topts.min_reps, &topts.max_reps) != 2) {
+        fprintf(stderr, "Please specify -r min,max.\n");
+        exit(1);
+      }
+      break;
+    case 'e':
+      topts.rel_ci = atof(optarg);
+      break;
+    case 'P':
+      pin_cpu = atoi(optarg);
+      break;
+    case 'G':
+      topts.ghz = atof(optarg);
+      break;
+    case 'l':
+      chain = 1;
+      break;
+    case 'T':
+      all_functions = 1;
+      break;
+    case 'H':
+      counters = 1;
+      break;
+    case 'F':
+      for (format = FORMAT_CSV; format >= 0; format--) {
+        if (strcmp(optarg, format_names[format]) == 0) break;
+      }
+      if (format < 0) {
+        fprintf(stderr, "Please specify -F table, json or csv.\n");
+        exit(1);
+      }
+      break;
+    case 'D':
+      if (n_dists == MAX_DISTRIBS) {
+        fprintf(stderr, "At most %d distributions.\n", MAX_DISTRIBS);
+        exit(1);
+      }
+      if (dist_parse(&dists[n_dists++], optarg) != 0) exit(1);
+      break;
+    case 'O':
+      for (order = ORDER_CONSTANT; order >= 0; order--) {
+        if (strcmp(optarg, order_names[order]) == 0) break;
+      }
+      if (order < 0) {
+        fprintf(stderr, "Please specify -O random, sorted or constant.\n");
+        exit(1);
+      }
+      break;
+    case 'K':
+      kernels = optarg;
+      break;
     case 'L':
-      list_functions();
-      exit(0);
+      list = 1;
+      break;
     case 'x':
       x_point = atof(optarg);
       single_point = 1;
@@ -157,6 +494,8 @@ int main(int argc, char **argv) {
     }
   }
 
+  if (n_dists == 0) dist_parse(&dists[n_dists++], "flat");
+
   // check parameters
   if (points < 1) {
     fprintf(stderr, "Please specify a positive number of test points per cycle.");
@@ -166,8 +505,29 @@ int main(int argc, char **argv) {
     fprintf(stderr, "Please specify a positive number of test cycles.");
     exit(1);
   }
-  fA.f_ptr = get_function(fA.f_name);
-  fB.f_ptr = get_function(fB.f_name);
+  if (topts.min_reps < 2 || topts.max_reps < topts.min_reps) {
+    fprintf(stderr, "Please specify 2 <= min <= max timed passes.");
+    exit(1);
+  }
+  if (load_kernels(kernels) < 0) exit(1);
+  if (list) {
+    list_functions();
+    exit(0);
+  }
+  if (sincos) {
+    fA.f_ptr = &sin_3;
+  } else if (find_function(&fA) && !batch) {
+    fA.batch_ptr = NULL;
+    fA.fbatch_ptr = NULL;
+  }
+  if (find_function(&fB)) {
+    fB.batch_ptr = NULL;
+    fB.fbatch_ptr = NULL;
+  }
+  if (batch && !sincos && fA.f_ptr != NULL &&
+      fA.batch_ptr == NULL && fA.fbatch_ptr == NULL) {
+    fprintf(stderr, "No batch version of %s, timing the scalar loop.\n", fA.f_name);
+  }
   if (fA.f_ptr == NULL) {
     fprintf(stderr, "Unable to find function: %s\n", fA.f_name);
     exit(1);
@@ -181,6 +541,27 @@ int main(int argc, char **argv) {
     fprintf(stderr, "function B = %s\n", fB.f_name);
   }
 
+  if (single_point && sincos) {
+    double s1, c1;
+    sincos_3(x_point, &s1, &c1);
+    double s2 = fB.f_ptr(x_point);
+    double c2 = fB.f_ptr(x_point + M_PI_2);
+    printf("%12s\t%+-20.17e\n", "x", x_point);
+    printf("%12s\t%+-20.17e\t%+-20.17e\n", fA.f_name, s1, c1);
+    printf("%12s\t%+-20.17e\t%+-20.17e\n", fB.f_name, s2, c2);
+    printf("%12s\t%+-20.17e\t%+-20.17e\n", "err", s1 - s2, c1 - c2);
+    dd s, c;
+    acc_init();
+    sincos_ref(x_point, &s, &c);
+    printf("%12s\t%+-20.17e\t%+-20.17e\n", "reference", s.hi, c.hi);
+    printf("%12s\t%20.4f\t%20.4f\n", "ulp A", ulp_error(s1, s, 53), ulp_error(c1, c, 53));
+    int single = fB.ff_ptr != NULL;
+    double xs = single ? (float)x_point : x_point;
+    double xc = single ? (float)(x_point + M_PI_2) : x_point + M_PI_2;
+    printf("%12s\t%20.4f\t%20.4f\n", "ulp B", ulp_error(s2, sin_ref(xs), single ? 24 : 53),
+           ulp_error(c2, sin_ref(xc), single ? 24 : 53));
+    exit(0);
+  }
   if (single_point) {
     double y1 = fA.f_ptr(x_point);
     double y2 = fB.f_ptr(x_point);
@@ -189,6 +570,11 @@ int main(int argc, char **argv) {
     printf("%12s\t%+-20.17e\n", fA.f_name, y1);
     printf("%12s\t%+-20.17e\n", fB.f_name, y2);
     printf("%12s\t%+-20.17e\n", "err", err);
+    acc_init();
+    dd ref = sin_ref(x_point);
+    printf("%12s\t%+-20.17e\n", "reference", ref.hi);
+    printf("%12s\t%20.4f\n", "ulp A", ulp_error(y1, ref, fA.ff_ptr != NULL ? 24 : 53));
+    printf("%12s\t%20.4f\n", "ulp B", ulp_error(y2, ref, fB.ff_ptr != NULL ? 24 : 53));
     // printf("%24s %31s %31s\n", "x", "fA(x)", "fB(x)");
     // printf("%+-20.17e\t%+-20.17e\t%+-20.17e\n", x_point, y1, y2);
     exit(0);
@@ -198,12 +584,24 @@ int main(int argc, char **argv) {
   double *x = malloc(points * sizeof(double));
   double *y1 = malloc(points * sizeof(double));
   double *y2 = malloc(points * sizeof(double));
+  double *y3 = malloc(points * sizeof(double));
+  double *y4 = malloc(points * sizeof(double));
   double *err = malloc(points * sizeof(double));
+  double *err_B = malloc(points * sizeof(double));
   struct benchCycle *cycle_log = malloc(cycles * sizeof(struct benchCycle));
-  if (x == NULL || y1 == NULL || y2 == NULL || err == NULL || cycle_log == NULL) {
+  if (x == NULL || y1 == NULL || y2 == NULL || y3 == NULL || y4 == NULL ||
+      err == NULL || err_B == NULL || cycle_log == NULL) {
     fprintf(stderr, "Unable to allocate memory.");
     exit(1);
   }
+  if (cold_block > 0) {
+    evict_buffer = calloc(EVICT_BYTES, 1);
+    if (evict_buffer == NULL) {
+      fprintf(stderr, "Unable to allocate memory.");
+      exit(1);
+    }
+    fprintf(stderr, "cold cache, flushed every %d calls\n", cold_block);
+  }
 
   // set up RNG
   const gsl_rng_type *T;
@@ -214,49 +612,129 @@ int main(int argc, char **argv) {
   fprintf(stderr, "generator type: %s\n", gsl_rng_name(r));
   fprintf(stderr, "seed = %lu\n", gsl_rng_default_seed);
 
-  clock_t begin, end;
-  double time_spent;
-  double min, max;
+  if (pin_cpu >= 0 && timer_pin(pin_cpu) != 0) {
+    fprintf(stderr, "Unable to pin to CPU %d, running unpinned.\n", pin_cpu);
+  }
+  timer_init();
+  acc_init();
+  fprintf(stderr, "timer: %s, %.3f ns/tick, overhead %llu ticks\n", timer_name,
+          timer_ns_per_tick, (unsigned long long)timer_overhead);
+  fprintf(stderr, "kernels: %s\n", sin_isa_name());
 
-  for (int c = 0; c < cycles; c++) {
-    for (int i = 0; i < points; i++) {
-      x[i] = gsl_ran_flat(r, min_x, max_x);
+  if (chain) fprintf(stderr, "latency: dependent calls\n");
+  if (counters) {
+    int n = perf_open();
+    if (n == 0) {
+      fprintf(stderr, "counters: none, %s\n", perf_error());
+    } else {
+      fprintf(stderr, "counters: %d of %d\n", n, PERF_COUNTERS);
     }
-    cycle_log[c].points = points;
-    gsl_stats_minmax(&(cycle_log[c].minx), &(cycle_log[c].maxx), x, 1, points);
+  }
 
-    // timing
-    begin = clock();
-    for (int i = 0; i < points; i++) {
-      y1[i] = fA.f_ptr(x[i]);
+  struct pass_args pass_A = {&fA, sincos, batch, x, y1, y3, points, cold_block, chain};
+  struct pass_args pass_B = {&fB, sincos, 0, x, y2, y4, points, cold_block, chain};
+  if (sincos) pass_A.f = NULL;
+
+  // sin_cr: how often it falls back to the slow path, and the time of
+  // the fast path alone
+  int cr = !sincos && (fA.f_ptr == &sin_cr || fB.f_ptr == &sin_cr);
+
+  if (order != ORDER_RANDOM) fprintf(stderr, "points: %s\n", order_names[order]);
+  // The rest goes with the table, or to stderr when stdout is data.
+  FILE *extra = format == FORMAT_TABLE ? stdout : stderr;
+
+  // Each distribution has its own cycles, results and counters.
+  for (int d = 0; d < n_dists; d++) {
+    struct distrib *dist = &dists[d];
+    if (n_dists > 1 || dist->kind != DIST_FLAT) {
+      fprintf(extra, "%sdistribution: %s\n", d > 0 && extra == stdout ? "\n" : "",
+              dist->spec);
+    }
+    if (all_functions) {
+      fill_points(x, points, dist, min_x, max_x, order);
+      print_all_functions(x, y1, points, cold_block, batch, &topts, counters);
+      continue;
     }
-    end = clock();
-    time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
-    cycle_log[c].ops_per_sec_A = points / time_spent;
 
-    begin = clock();
-    for (int i = 0; i < points; i++) {
-      y2[i] = fB.f_ptr(x[i]);
+    uint64_t cr_slow = 0, cr_calls = 0;
+    for (int c = 0; c < cycles; c++) {
+      fill_points(x, points, dist, min_x, max_x, order);
+      if (fA.ff_ptr != NULL || fB.ff_ptr != NULL) {
+        for (int i = 0; i < points; i++) {
+          x[i] = (float)x[i];   // the same arguments for both functions
+        }
+      }
+      cycle_log[c].points = points;
+      gsl_stats_minmax(&(cycle_log[c].minx), &(cycle_log[c].maxx), x, 1, points);
+
+      // timing
+      timing_measure(timed_pass, &pass_A, points, &topts, &cycle_log[c].time_A);
+      timing_measure(timed_pass, &pass_B, points, &topts, &cycle_log[c].time_B);
+      if (cr) {
+        cr_slow += sin_cr_slow_calls(x, fA.f_ptr == &sin_cr ? y1 : y2, points);
+        cr_calls += points;
+      }
+      int bits_A = fA.ff_ptr != NULL ? 24 : 53;
+      int bits_B = fB.ff_ptr != NULL ? 24 : 53;
+      for (int i = 0; i < points; i++) {
+        dd s, c;
+        sincos_ref(x[i], &s, &c);
+        err[i] = ulp_error(y1[i], s, bits_A);
+        err_B[i] = ulp_error(y2[i], s, bits_B);
+        if (sincos) {
+          // B's Cos is its Sin at the rounded x + Pi/2 it was given
+          double xc = x[i] + M_PI_2;
+          if (bits_B == 24) xc = (float)xc;
+          err[i] = fmax(err[i], ulp_error(y3[i], c, bits_A));
+          err_B[i] = fmax(err_B[i], ulp_error(y4[i], sin_ref(xc), bits_B));
+        }
+      }
+      cycle_log[c].mean_err = gsl_stats_mean(err, 1, points);
+      cycle_log[c].max_err = gsl_stats_max(err, 1, points);
+      cycle_log[c].max_err_B = gsl_stats_max(err_B, 1, points);
     }
-    end = clock();
-    time_spent = (double)(end - begin) / CLOCKS_PER_SEC;
-    cycle_log[c].ops_per_sec_B = points / time_spent;
 
-    for (int i = 0; i < points; i++) {
-      err[i] = fabs(y1[i] - y2[i]);
+    struct bench_run run = {fA.f_name, fB.f_name, batch, chain, sincos, cold_block, topts,
+                            order_names[order], dist->spec, min_x, max_x,
+                            gsl_rng_default_seed, cycles};
+    switch (format) {
+    case FORMAT_JSON: results_json(stdout, &run, cycle_log);         break;
+    case FORMAT_CSV:  results_csv(stdout, &run, cycle_log, d == 0);  break;
+    default:          print_stats(cycle_log, cycles);                break;
+    }
+    if (counters) {
+      // over the last cycle's points
+      fprintf(extra, "\n");
+      print_counter_header(extra);
+      print_counter_row(extra, sincos ? "sincos3" : fA.f_name, &pass_A);
+      print_counter_row(extra, fB.f_name, &pass_B);
+    }
+    if (cr) {
+      struct function_item fast = {"sincr_fast", &sin_cr_fast, NULL};
+      struct pass_args pass = {&fast, 0, 0, x, y3, NULL, points, cold_block, chain};
+      struct timing t;
+      timing_measure(timed_pass, &pass, points, &topts, &t);
+      fprintf(extra, "sincr: slow path on %llu of %llu calls (%.3g%%); fast path alone "
+             "%.3f +- %.3f ns/call, %.2f cycles\n",
+             (unsigned long long)cr_slow, (unsigned long long)cr_calls,
+             100.0 * cr_slow / cr_calls, t.ns, t.ns_ci, t.cycles);
     }
-    cycle_log[c].mean_err = gsl_stats_mean(err, 1, points);
-    gsl_stats_minmax(&cycle_log[c].min_err, &cycle_log[c].max_err, err, 1, points);
   }
 
-  print_stats(cycle_log, cycles);
-
   // clean up
+  if (counters) perf_close();
   gsl_rng_free(r);
   free(x);
   free(y1);
   free(y2);
+  free(y3);
+  free(y4);
   free(err);
+  free(err_B);
   free(cycle_log);
+  free(evict_buffer);
+  free(xf);
+  free(yf);
+  for (int d = 0; d < n_dists; d++) dist_free(&dists[d]);
   return 0;
 }
@@ -0,0 +1,289 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+char* help_string =
+  "compare - Regressions between two benchmark -F csv files.\n"
+  "usage: compare [-h]\n"
+  "       compare [-t percent] [-u ulp] old.csv new.csv\n\n"
+  "    -t percent          Flag a function as slower when its time per call\n"
+  "                        went up by more than this, and the change is\n"
+  "                        significant at 95%.  Default 5\n"
+  "    -u ulp              Flag it as less accurate when its max error went up\n"
+  "                        by more than this.  Default 0.01\n"
+  "    -h                  Display this help.\n\n"
+  "Functions A and B of every row are matched by name, with batch, latency,\n"
+  "-S, cold cache block, timed passes, point order and distribution as part\n"
+  "of the name, and their cycles pooled.\n"
+  "A file may hold several runs, concatenated.  The exit status is 1 if\n"
+  "anything was flagged, 2 if a file couldn't be read.\n";
+
+#define MAX_FIELDS 64
+#define MAX_FUNCTIONS 256
+
+// A function's cycles in one file
+struct fstats {
+  char          key[256];
+  int           cycles;
+  double        sum_ns;
+  double        sum_ns2;
+  double        sum_var;        // of the cycle means, from their CIs
+  double        max_ulp;
+};
+
+struct file_stats {
+  struct fstats f[MAX_FUNCTIONS];
+  int           n;
+};
+
+// Split a CSV line in place; quoted fields may hold commas and "".
+static int split_csv(char *line, char **fields) {
+  int n = 0;
+  char *p = line;
+  line[strcspn(line, "\r\n")] = '\0';
+  while (n < MAX_FIELDS) {
+    if (*p == '"') {
+      char *out = ++p;
+      fields[n++] = out;
+      while (*p != '\0') {
+        if (*p == '"' && p[1] == '"') {
+          *out++ = '"';
+          p += 2;
+        } else if (*p == '"') {
+          p++;
+          break;
+        } else {
+          *out++ = *p++;
+        }
+      }
+      *out = '\0';
+      p += strcspn(p, ",");
+    } else {
+      fields[n++] = p;
+      p += strcspn(p, ",");
+    }
+    if (*p != ',') break;
+    *p++ = '\0';
+  }
+  return n;
+}
+
+static struct fstats *find_key(struct file_stats *fs, const char *key) {
+  for (int i = 0; i < fs->n; i++) {
+    if (strcmp(fs->f[i].key, key) == 0) return &fs->f[i];
+  }
+  if (fs->n == MAX_FUNCTIONS) return NULL;
+  struct fstats *f = &fs->f[fs->n++];
+  memset(f, 0, sizeof(*f));
+  snprintf(f->key, sizeof(f->key), "%s", key);
+  return f;
+}
+
+static void add_cycle(struct fstats *f, double ns, double ns_ci, double max_ulp) {
+  double se = ns_ci / 1.96;
+  f->cycles++;
+  f->sum_ns += ns;
+  f->sum_ns2 += ns * ns;
+  f->sum_var += se * se;
+  if (max_ulp > f->max_ulp) f->max_ulp = max_ulp;
+}
+
+static double mean_ns(const struct fstats *f) {
+  return f->sum_ns / f->cycles;
+}
+
+// Standard error of mean_ns: from the cycles' own intervals, or from
+// the spread between cycles, whichever is larger.
+static double se_ns(const struct fstats *f) {
+  double se = sqrt(f->sum_var) / f->cycles;
+  if (f->cycles >= 2) {
+    double m = mean_ns(f);
+    double var = (f->sum_ns2 - f->cycles * m * m) / (f->cycles - 1);
+    double spread = sqrt(var > 0.0 ? var / f->cycles : 0.0);
+    if (spread > se) se = spread;
+  }
+  return se;
+}
+
+static const char *columns[] = {
+  "function_A", "function_B", "batch", "latency", "order",
+  "ns_A", "ns_ci_A", "ns_B", "ns_ci_B", "max_ulp_A", "max_ulp_B",
+  // optional, older files have none of these
+  "distribution", "sincos", "cold_block", "warmup", "min_reps", "max_reps", "rel_ci",
+};
+enum { C_FA, C_FB, C_BATCH, C_LATENCY, C_ORDER, C_NS_A, C_NS_CI_A, C_NS_B,
+       C_NS_CI_B, C_MAX_ULP_A, C_MAX_ULP_B, C_DISTRIBUTION, C_SINCOS, C_COLD_BLOCK,
+       C_WARMUP, C_MIN_REPS, C_MAX_REPS, C_REL_CI, C_COLUMNS };
+#define C_OPTIONAL C_DISTRIBUTION
+
+// What benchmark wrote in column c, or its default if the file has no
+// such column.
+static const char *field(char **fields, const int *col, int c) {
+  static const char *defaults[C_COLUMNS] = {
+    [C_DISTRIBUTION] = "flat", [C_SINCOS] = "0", [C_COLD_BLOCK] = "0",
+    [C_WARMUP] = "2", [C_MIN_REPS] = "5", [C_MAX_REPS] = "100", [C_REL_CI] = "0.01",
+  };
+  return col[c] >= 0 ? fields[col[c]] : defaults[c];
+}
+
+// The settings that change the timing, added to the names so that
+// only like runs are pooled and compared; defaults are left out.
+static void run_mode(char **fields, const int *col, char *mode, size_t len) {
+  int n = 0;
+  mode[0] = '\0';
+  if (atoi(field(fields, col, C_LATENCY))) n += snprintf(mode + n, len - n, " latency");
+  if (atoi(field(fields, col, C_SINCOS))) n += snprintf(mode + n, len - n, " pairs");
+  int cold = atoi(field(fields, col, C_COLD_BLOCK));
+  if (cold > 0) n += snprintf(mode + n, len - n, " cold %d", cold);
+  int warmup = atoi(field(fields, col, C_WARMUP));
+  int min_reps = atoi(field(fields, col, C_MIN_REPS));
+  int max_reps = atoi(field(fields, col, C_MAX_REPS));
+  double rel_ci = atof(field(fields, col, C_REL_CI));
+  if (warmup != 2 || min_reps != 5 || max_reps != 100 || rel_ci != 0.01) {
+    n += snprintf(mode + n, len - n, " w%d r%d,%d e%g", warmup, min_reps, max_reps, rel_ci);
+  }
+  const char *order = field(fields, col, C_ORDER);
+  if (strcmp(order, "random") != 0) n += snprintf(mode + n, len - n, " %s", order);
+  const char *dist = field(fields, col, C_DISTRIBUTION);
+  if (strcmp(dist, "flat") != 0) snprintf(mode + n, len - n, " %s", dist);
+}
+
+static int read_file(const char *path, struct file_stats *fs) {
+  FILE *in = fopen(path, "r");
+  if (in == NULL) {
+    perror(path);
+    return 0;
+  }
+  fs->n = 0;
+  char line[4096];
+  char *fields[MAX_FIELDS];
+  int col[C_COLUMNS];
+  int have_header = 0;
+  while (fgets(line, sizeof(line), in) != NULL) {
+    int n = split_csv(line, fields);
+    if (n <= 1) continue;
+    if (strcmp(fields[0], "hostname") == 0) {        // a header, maybe again
+      for (int c = 0; c < C_COLUMNS; c++) {
+        col[c] = -1;
+        for (int i = 0; i < n; i++) {
+          if (strcmp(fields[i], columns[c]) == 0) col[c] = i;
+        }
+        if (col[c] < 0 && c < C_OPTIONAL) {
+          fprintf(stderr, "%s: no %s column.\n", path, columns[c]);
+          fclose(in);
+          return 0;
+        }
+      }
+      have_header = 1;
+      continue;
+    }
+    if (!have_header) {
+      fprintf(stderr, "%s: not benchmark -F csv output.\n", path);
+      fclose(in);
+      return 0;
+    }
+    int max_col = 0;
+    for (int c = 0; c < C_COLUMNS; c++) {
+      if (col[c] > max_col) max_col = col[c];
+    }
+    if (n <= max_col) continue;
+
+    // A's name and B's carry what changes the timing
+    char mode[192], key[256];
+    run_mode(fields, col, mode, sizeof(mode));
+    snprintf(key, sizeof(key), "%s%s%s", fields[col[C_FA]],
+             atoi(fields[col[C_BATCH]]) ? " batch" : "", mode);
+    struct fstats *f = find_key(fs, key);
+    if (f != NULL) {
+      add_cycle(f, atof(fields[col[C_NS_A]]), atof(fields[col[C_NS_CI_A]]),
+                atof(fields[col[C_MAX_ULP_A]]));
+    }
+    snprintf(key, sizeof(key), "%s%s", fields[col[C_FB]], mode);
+    f = find_key(fs, key);
+    if (f != NULL) {
+      add_cycle(f, atof(fields[col[C_NS_B]]), atof(fields[col[C_NS_CI_B]]),
+                atof(fields[col[C_MAX_ULP_B]]));
+    }
+  }
+  fclose(in);
+  if (fs->n == 0) {
+    fprintf(stderr, "%s: no results.\n", path);
+    return 0;
+  }
+  return 1;
+}
+
+static struct file_stats old_stats, new_stats;
+
+int main(int argc, char **argv) {
+  double max_slower = 5.0;
+  double max_ulp = 0.01;
+
+  int c;
+  while ((c = getopt(argc, argv, "t:u:h")) != -1) {
+    switch (c) {
+    case 't':
+      max_slower = atof(optarg);
+      break;
+    case 'u':
+      max_ulp = atof(optarg);
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(2);
+    }
+  }
+  if (optind + 2 != argc) {
+    fprintf(stderr, "%s\n", help_string);
+    exit(2);
+  }
+  if (!read_file(argv[optind], &old_stats) || !read_file(argv[optind + 1], &new_stats)) {
+    exit(2);
+  }
+
+  int flagged = 0;
+  printf("%-24s %10s %10s %8s %7s %10s %10s  %s\n", "function", "old ns", "new ns",
+         "change", "+-", "old ulp", "new ulp", "");
+  for (int i = 0; i < new_stats.n; i++) {
+    const struct fstats *n = &new_stats.f[i];
+    const struct fstats *o = NULL;
+    for (int j = 0; j < old_stats.n; j++) {
+      if (strcmp(old_stats.f[j].key, n->key) == 0) o = &old_stats.f[j];
+    }
+    if (o == NULL) {
+      printf("%-24s %10s %10.3f %8s %7s %10s %10.4g  new\n", n->key, "", mean_ns(n),
+             "", "", "", n->max_ulp);
+      continue;
+    }
+    // change and its 95% interval, in percent of the old time
+    double change = 100.0 * (mean_ns(n) - mean_ns(o)) / mean_ns(o);
+    double ci = 100.0 * 1.96 * hypot(se_ns(n), se_ns(o)) / mean_ns(o);
+    const char *verdict = "";
+    if (change > max_slower && change > ci) {
+      verdict = "SLOWER";
+      flagged = 1;
+    } else if (-change > ci) {
+      verdict = "faster";
+    }
+    if (n->max_ulp > o->max_ulp + max_ulp) {
+      verdict = *verdict == 'S' ? "SLOWER, LESS ACCURATE" : "LESS ACCURATE";
+      flagged = 1;
+    }
+    printf("%-24s %10.3f %10.3f %+7.1f%% %6.1f%% %10.4g %10.4g  %s\n", n->key,
+           mean_ns(o), mean_ns(n), change, ci, o->max_ulp, n->max_ulp, verdict);
+  }
+  for (int j = 0; j < old_stats.n; j++) {
+    int found = 0;
+    for (int i = 0; i < new_stats.n; i++) {
+      found |= strcmp(old_stats.f[j].key, new_stats.f[i].key) == 0;
+    }
+    if (!found) printf("%-24s %10.3f %10s %8s %7s %10.4g %10s  gone\n", old_stats.f[j].key,
+                       mean_ns(&old_stats.f[j]), "", "", "", old_stats.f[j].max_ulp, "");
+  }
+  return flagged;
+}
@@ -0,0 +1,131 @@
+// dd.h
+// Double-double arithmetic: a value is the unevaluated sum hi + lo
+// with |lo| <= ulp(hi)/2, good to about 106 bits.  The error-free
+// transformations are the usual ones (Dekker, Knuth, and FMA for the
+// product); see Goldberg in refs/.  Everything here depends on the
+// compiler not contracting a*b + c into an FMA behind our back, so
+// build with -ffp-contract=off.
+
+#ifndef DD_H
+#define DD_H
+
+#include <math.h>
+
+typedef struct {
+  double hi;
+  double lo;
+} dd;
+
+static inline dd dd_make(double hi, double lo) {
+  dd r = {hi, lo};
+  return r;
+}
+
+// a + b exactly, any a and b
+static inline dd two_sum(double a, double b) {
+  double s = a + b;
+  double bb = s - a;
+  return dd_make(s, (a - (s - bb)) + (b - bb));
+}
+
+// a + b exactly, |a| >= |b|
+static inline dd fast_two_sum(double a, double b) {
+  double s = a + b;
+  return dd_make(s, b - (s - a));
+}
+
+// a * b exactly
+static inline dd two_prod(double a, double b) {
+  double p = a * b;
+  return dd_make(p, fma(a, b, -p));
+}
+
+static inline dd dd_add(dd a, dd b) {
+  dd s = two_sum(a.hi, b.hi);
+  dd t = two_sum(a.lo, b.lo);
+  s.lo += t.hi;
+  s = fast_two_sum(s.hi, s.lo);
+  s.lo += t.lo;
+  return fast_two_sum(s.hi, s.lo);
+}
+
+static inline dd dd_neg(dd a) {
+  return dd_make(-a.hi, -a.lo);
+}
+
+static inline dd dd_sub(dd a, dd b) {
+  return dd_add(a, dd_neg(b));
+}
+
+static inline dd dd_add_d(dd a, double b) {
+  dd s = two_sum(a.hi, b);
+  s.lo += a.lo;
+  return fast_two_sum(s.hi, s.lo);
+}
+
+static inline dd dd_mul(dd a, dd b) {
+  dd p = two_prod(a.hi, b.hi);
+  p.lo += a.hi * b.lo + a.lo * b.hi;
+  return fast_two_sum(p.hi, p.lo);
+}
+
+static inline dd dd_mul_d(dd a, double b) {
+  dd p = two_prod(a.hi, b);
+  p.lo += a.lo * b;
+  return fast_two_sum(p.hi, p.lo);
+}
+
+static inline dd dd_div(dd a, dd b) {
+  double q1 = a.hi / b.hi;
+  dd r = dd_sub(a, dd_mul_d(b, q1));
+  double q2 = r.hi / b.hi;
+  r = dd_sub(r, dd_mul_d(b, q2));
+  double q3 = r.hi / b.hi;
+  dd q = fast_two_sum(q1, q2);
+  return dd_add_d(q, q3);
+}
+
+static inline dd dd_sqrt(dd a) {
+  if (a.hi <= 0.0) return dd_make(sqrt(a.hi), 0.0);
+  double s = sqrt(a.hi);
+  dd e = dd_sub(a, two_prod(s, s));
+  return fast_two_sum(s, e.hi / (2.0 * s));
+}
+
+static inline dd dd_abs(dd a) {
+  return a.hi < 0.0 ? dd_neg(a) : a;
+}
+
+static inline double dd_to_double(dd a) {
+  return a.hi + a.lo;
+}
+
+// Pi and Pi/2 to double-double precision
+static const dd dd_pi = {3.141592653589793116e+00, 1.224646799147353207e-16};
+static const dd dd_pi_2 = {1.570796326794896558e+00, 6.123233995736766036e-17};
+
+// Sin and Cos by their Taylor series, for |x| <= 2 or so: accurate
+// but slow, meant for generating and checking tables, not for use in
+// a kernel.
+static inline void dd_sincos_taylor(dd x, dd *s, dd *c) {
+  dd x2 = dd_mul(x, x);
+  dd term = x;                          // x^(2k+1)/(2k+1)!
+  dd sum_s = x;
+  dd term_c = dd_make(1.0, 0.0);        // x^(2k)/(2k)!
+  dd sum_c = term_c;
+  for (int k = 1; k < 30; k++) {
+    term = dd_div(dd_mul(term, x2), dd_make((2.0 * k) * (2.0 * k + 1), 0.0));
+    term_c = dd_div(dd_mul(term_c, x2), dd_make((2.0 * k - 1) * (2.0 * k), 0.0));
+    if (k & 1) {
+      sum_s = dd_sub(sum_s, term);
+      sum_c = dd_sub(sum_c, term_c);
+    } else {
+      sum_s = dd_add(sum_s, term);
+      sum_c = dd_add(sum_c, term_c);
+    }
+  }
+  *s = sum_s;
+  *c = sum_c;
+}
+
+#endif
@@ -0,0 +1,232 @@
+#include <stddef.h>
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "mysin.h"
+
+// Bind sin_3 and the batch entry points to the best kernels the CPU
+// has, once, at load time.
+//
+// On x86-64 Linux the entry points are GNU ifuncs: the dynamic linker
+// (or the startup code of a static binary) calls the resolver once and
+// writes the kernel's address where the call goes, so a call costs
+// what any call into the library does.  Mach-O has no ifuncs, so on
+// macOS a constructor fills a table and the batch entry points jump
+// through it; a batch call does enough work that the extra branch
+// doesn't show.  sin_3 has a single arm64 version and isn't dispatched
+// there.
+//
+// MYSIN_ISA=scalar|neon|avx2|avx512 in the environment forces a lower
+// level than the best, to compare them; a level the CPU doesn't have
+// is ignored.
+
+static const char *isa_names[] = {"scalar", "neon", "avx2", "avx512"};
+
+static int isa_supported(int isa) {
+  switch (isa) {
+  case SIN_ISA_SCALAR:
+    return 1;
+#if defined(__aarch64__)
+  case SIN_ISA_NEON:
+    return 1;
+#endif
+#if defined(__x86_64__)
+  case SIN_ISA_AVX2:
+    __builtin_cpu_init();       // resolvers may run before libgcc's constructor
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  case SIN_ISA_AVX512:
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx512f");
+#endif
+  default:
+    return 0;
+  }
+}
+
+// The value of MYSIN_ISA.  The resolvers run early: in a static binary
+// before the C library's string functions are bound, in a shared one
+// before it has set environ.  So environ is searched by hand, and if
+// it isn't there yet, /proc/self/environ is read instead.
+extern char **environ;
+
+static const char *after_key(const char *entry) {
+  static const char key[] = "MYSIN_ISA=";
+  for (int i = 0; key[i] != '\0'; i++) {
+    if (entry[i] != key[i]) return NULL;
+  }
+  return entry + sizeof(key) - 1;
+}
+
+static int same_name(const char *a, const char *b) {
+  while (*a != '\0' && *a == *b) a++, b++;
+  return *a == *b;
+}
+
+static const char *isa_env(void) {
+  const char *value = NULL;
+  if (environ != NULL) {
+    for (char **e = environ; *e != NULL && value == NULL; e++) value = after_key(*e);
+    return value;
+  }
+#if defined(__linux__)
+  static char buf[1 << 16];
+  int fd = open("/proc/self/environ", O_RDONLY);
+  if (fd < 0) return NULL;
+  size_t n = 0;
+  ssize_t r;
+  while (n < sizeof(buf) - 1 && (r = read(fd, buf + n, sizeof(buf) - 1 - n)) > 0) {
+    n += r;
+  }
+  close(fd);
+  buf[n] = '\0';
+  for (size_t i = 0; i < n && value == NULL; i++) {
+    value = after_key(buf + i);
+    while (buf[i] != '\0') i++;
+  }
+#endif
+  return value;
+}
+
+int sin_isa(void) {
+  static int isa = -1;
+  if (isa >= 0) return isa;
+
+  int best = SIN_ISA_AVX512;
+  while (!isa_supported(best)) best--;
+  isa = best;
+  const char *env = isa_env();
+  for (int i = 0; env != NULL && i <= SIN_ISA_AVX512; i++) {
+    if (same_name(env, isa_names[i]) && isa_supported(i)) isa = i;
+  }
+  return isa;
+}
+
+const char *sin_isa_name(void) {
+  return isa_names[sin_isa()];
+}
+
+typedef void (*batch_fn)(const double *, double *, size_t);
+typedef void (*sincos_batch_fn)(const double *, double *, double *, size_t);
+typedef void (*sinf_batch_fn)(const float *, float *, size_t);
+
+static batch_fn pick_sin_3_batch(void) {
+  switch (sin_isa()) {
+#if defined(__aarch64__)
+  case SIN_ISA_NEON:   return sin_3_batch_neon;
+#endif
+#if defined(__x86_64__)
+  case SIN_ISA_AVX2:   return sin_3_batch_avx2;
+  case SIN_ISA_AVX512: return sin_3_batch_avx512;
+#endif
+  default:             return sin_3_batch_scalar;
+  }
+}
+
+static sincos_batch_fn pick_sincos_3_batch(void) {
+  switch (sin_isa()) {
+#if defined(__aarch64__)
+  case SIN_ISA_NEON:   return sincos_3_batch_neon;
+#endif
+#if defined(__x86_64__)
+  case SIN_ISA_AVX2:   return sincos_3_batch_avx2;
+  case SIN_ISA_AVX512: return sincos_3_batch_avx512;
+#endif
+  default:             return sincos_3_batch_scalar;
+  }
+}
+
+static sinf_batch_fn pick_sinf_3_batch(void) {
+  switch (sin_isa()) {
+#if defined(__aarch64__)
+  case SIN_ISA_NEON:   return sinf_3_batch_neon;
+#endif
+#if defined(__x86_64__)
+  case SIN_ISA_AVX2:   return sinf_3_batch_avx2;
+  case SIN_ISA_AVX512: return sinf_3_batch_avx512;
+#endif
+  default:             return sinf_3_batch_scalar;
+  }
+}
+
+#if defined(__x86_64__) && defined(__ELF__)
+
+// sin_x86.c and the C kernels built with and without FMA (variant.h);
+// the vector levels all have it.
+#define X86_KERNEL(ret, name, params)                                   \
+  ret name##_fma params;                                                \
+  ret name##_generic params;                                            \
+  static void *name##_resolve(void) {                                   \
+    return sin_isa() >= SIN_ISA_AVX2 ? (void *)name##_fma : (void *)name##_generic; \
+  }                                                                     \
+  ret name params __attribute__((ifunc(#name "_resolve")));
+
+X86_KERNEL(double, sin_1, (double x))
+X86_KERNEL(double, sin_2, (double x))
+X86_KERNEL(double, sin_3, (double x))
+X86_KERNEL(double, sin_3b, (double x))
+X86_KERNEL(double, sin_3e, (double x))
+X86_KERNEL(double, sin_4, (double x))
+X86_KERNEL(void, sincos_3, (double x, double *s, double *c))
+X86_KERNEL(float, sinf_3, (float x))
+X86_KERNEL(double, reduce, (double x))
+X86_KERNEL(double, sin_5, (double x))
+X86_KERNEL(double, sin_5_64, (double x))
+X86_KERNEL(double, sin_5_256, (double x))
+X86_KERNEL(double, sin_cr, (double x))
+X86_KERNEL(double, sin_cr_fast, (double x))
+X86_KERNEL(void, sin_cr_counts, (uint64_t *slow, uint64_t *undecided))
+X86_KERNEL(void, sin_dd, (double x, double *hi, double *lo))
+X86_KERNEL(void, sin_dd_batch, (const double *x, double *hi, double *lo, size_t n))
+X86_KERNEL(double, sin_approx_pi2_7, (double x))
+X86_KERNEL(double, sin_approx_pi2_9, (double x))
+X86_KERNEL(double, sin_approx_pi2_11, (double x))
+X86_KERNEL(double, sin_approx_pi2_13, (double x))
+X86_KERNEL(double, sin_approx_pi2_15, (double x))
+X86_KERNEL(double, sin_approx_pi4_7, (double x))
+X86_KERNEL(double, sin_approx_pi4_9, (double x))
+X86_KERNEL(double, sin_approx_pi4_11, (double x))
+X86_KERNEL(double, sin_approx_pi4_13, (double x))
+X86_KERNEL(double, gslReduce, (double x))
+X86_KERNEL(int, cwReduce, (double x, double *hi, double *lo))
+X86_KERNEL(int, phReduce, (double x, double *hi, double *lo))
+X86_KERNEL(int, phReduce128, (double x, int *neg, unsigned __int128 *r, int *exp))
+X86_KERNEL(uint64_t, two_over_pi_bits, (int s))
+
+static void *sin_3_batch_resolve(void) { return pick_sin_3_batch(); }
+static void *sincos_3_batch_resolve(void) { return pick_sincos_3_batch(); }
+static void *sinf_3_batch_resolve(void) { return pick_sinf_3_batch(); }
+
+void sin_3_batch(const double *x, double *y, size_t n)
+  __attribute__((ifunc("sin_3_batch_resolve")));
+void sincos_3_batch(const double *x, double *s, double *c, size_t n)
+  __attribute__((ifunc("sincos_3_batch_resolve")));
+void sinf_3_batch(const float *x, float *y, size_t n)
+  __attribute__((ifunc("sinf_3_batch_resolve")));
+
+#else
+
+static batch_fn sin_3_batch_ptr;
+static sincos_batch_fn sincos_3_batch_ptr;
+static sinf_batch_fn sinf_3_batch_ptr;
+
+__attribute__((constructor)) static void bind_kernels(void) {
+  sin_3_batch_ptr = pick_sin_3_batch();
+  sincos_3_batch_ptr = pick_sincos_3_batch();
+  sinf_3_batch_ptr = pick_sinf_3_batch();
+}
+
+void sin_3_batch(const double *x, double *y, size_t n) {
+  sin_3_batch_ptr(x, y, n);
+}
+
+void sincos_3_batch(const double *x, double *s, double *c, size_t n) {
+  sincos_3_batch_ptr(x, s, c, n);
+}
+
+void sinf_3_batch(const float *x, float *y, size_t n) {
+  sinf_3_batch_ptr(x, y, n);
+}
+
+#endif
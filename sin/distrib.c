@@ -0,0 +1,168 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+
+#include <gsl/gsl_randist.h>
+
+#include "distrib.h"
+
+static const char *kind_names[DIST_KINDS] = {
+  "flat", "log", "halfpi", "sweep", "file", "special"
+};
+
+// The whole file in memory, so the timed passes don't wait on it.
+static int read_points(struct distrib *d, const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (in == NULL || fseek(in, 0, SEEK_END) != 0) {
+    perror(path);
+    if (in != NULL) fclose(in);
+    return -1;
+  }
+  long bytes = ftell(in);
+  rewind(in);
+  d->n = bytes / (long)sizeof(double);
+  if (d->n == 0) {
+    fprintf(stderr, "%s: no doubles in the file.\n", path);
+    fclose(in);
+    return -1;
+  }
+  d->data = malloc(d->n * sizeof(double));
+  if (d->data == NULL) {
+    fprintf(stderr, "Unable to allocate memory.");
+    fclose(in);
+    return -1;
+  }
+  if (fread(d->data, sizeof(double), d->n, in) != (size_t)d->n) {
+    perror(path);
+    fclose(in);
+    return -1;
+  }
+  fclose(in);
+  d->next = 0;
+  return 0;
+}
+
+int dist_parse(struct distrib *d, const char *spec) {
+  memset(d, 0, sizeof(*d));
+  d->spec = spec;
+  size_t len = strcspn(spec, ":");
+  for (d->kind = DIST_KINDS - 1; d->kind >= 0; d->kind--) {
+    if (strlen(kind_names[d->kind]) == len && strncmp(spec, kind_names[d->kind], len) == 0) {
+      break;
+    }
+  }
+  if (d->kind < 0) {
+    fprintf(stderr, "Please specify -D flat, log, halfpi, sweep, file:path or special.\n");
+    return -1;
+  }
+  const char *args = spec[len] == ':' ? spec + len + 1 : NULL;
+
+  switch (d->kind) {
+  case DIST_FILE:
+    if (args == NULL || *args == '\0') {
+      fprintf(stderr, "Please specify -D file:path.\n");
+      return -1;
+    }
+    return read_points(d, args);
+  case DIST_LOG:
+  case DIST_HALFPI:
+    d->lo = d->kind == DIST_LOG ? -30 : -50;
+    d->hi = d->kind == DIST_LOG ? 30 : -20;
+    if (args != NULL && sscanf(args, "%lf,%lf", &d->lo, &d->hi) != 2) {
+      fprintf(stderr, "Please specify -D %s:lo,hi.\n", kind_names[d->kind]);
+      return -1;
+    }
+    if (!(d->lo <= d->hi && d->lo >= -1074 && d->hi < 1024)) {
+      fprintf(stderr, "Please specify exponents -1074 <= lo <= hi < 1024.\n");
+      return -1;
+    }
+    return 0;
+  default:
+    if (args != NULL) {
+      fprintf(stderr, "-D %s takes no arguments.\n", kind_names[d->kind]);
+      return -1;
+    }
+    return 0;
+  }
+}
+
+void dist_free(struct distrib *d) {
+  free(d->data);
+  d->data = NULL;
+}
+
+static double random_sign(gsl_rng *r, double x) {
+  return gsl_rng_uniform(r) < 0.5 ? -x : x;
+}
+
+// 2^e, e uniform on [lo, hi], either sign
+static double log_uniform(gsl_rng *r, double lo, double hi) {
+  return random_sign(r, exp2(gsl_ran_flat(r, lo, hi)));
+}
+
+// k*Pi/2 in [min, max], plus or minus 2^e
+static double near_half_pi(gsl_rng *r, double min_x, double max_x, double lo, double hi) {
+  double k_min = ceil(min_x / M_PI_2), k_max = floor(max_x / M_PI_2);
+  double k = k_min > k_max ? 0.0 : k_min + floor(gsl_rng_uniform(r) * (k_max - k_min + 1));
+  return k * M_PI_2 + log_uniform(r, lo, hi);
+}
+
+// One of the arguments that take kernels off their usual path, or an
+// ordinary one; each kind equally often.
+static double special_point(gsl_rng *r, double min_x, double max_x) {
+  union { double d; uint64_t u; } b;
+  switch ((int)(gsl_rng_uniform(r) * 8)) {
+  case 0:
+    return random_sign(r, 0.0);
+  case 1:                       // subnormal
+    do {
+      b.u = (uint64_t)(gsl_rng_uniform(r) * 0x1p26) << 26 | (uint64_t)(gsl_rng_uniform(r) * 0x1p26);
+    } while (b.u == 0);
+    return random_sign(r, b.d);
+  case 2:                       // sin x rounds to x
+    return log_uniform(r, -1022, -26);
+  case 3:
+    return near_half_pi(r, min_x, max_x, -50, -20);
+  case 4:                       // past the kernels' Cody-Waite range
+    return log_uniform(r, 30, 1023);
+  case 5:
+    return random_sign(r, INFINITY);
+  case 6:
+    return NAN;
+  default:
+    return gsl_ran_flat(r, min_x, max_x);
+  }
+}
+
+void dist_fill(struct distrib *d, gsl_rng *r, double *x, int points,
+               double min_x, double max_x) {
+  switch (d->kind) {
+  case DIST_LOG:
+    for (int i = 0; i < points; i++) x[i] = log_uniform(r, d->lo, d->hi);
+    break;
+  case DIST_HALFPI:
+    for (int i = 0; i < points; i++) x[i] = near_half_pi(r, min_x, max_x, d->lo, d->hi);
+    break;
+  case DIST_SWEEP: {
+    double start = gsl_rng_uniform(r);
+    for (int i = 0; i < points; i++) {
+      x[i] = min_x + (max_x - min_x) * ((i + start) / points);
+    }
+    break;
+  }
+  case DIST_FILE:
+    for (int i = 0; i < points; i++) {
+      x[i] = d->data[d->next];
+      if (++d->next == d->n) d->next = 0;
+    }
+    break;
+  case DIST_SPECIAL:
+    for (int i = 0; i < points; i++) x[i] = special_point(r, min_x, max_x);
+    break;
+  default:
+    for (int i = 0; i < points; i++) x[i] = gsl_ran_flat(r, min_x, max_x);
+    break;
+  }
+}
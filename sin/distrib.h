@@ -0,0 +1,43 @@
+// distrib.h
+// The distributions benchmark draws its points from (-D).
+//
+//   flat              uniform on [min, max], as before
+//   log[:lo,hi]       |x| = 2^e with e uniform on [lo, hi], either sign;
+//                     -30,30 by default
+//   halfpi[:lo,hi]    k*Pi/2 + d for integer k*Pi/2 in [min, max] and
+//                     |d| = 2^e, e uniform on [lo, hi]; -50,-20 by default
+//   sweep             evenly spaced from min to max, from a random start
+//   file:path         replay raw doubles from path, as sinmap reads them,
+//                     going round again at the end
+//   special           ordinary points mixed with zeros, subnormals, tiny,
+//                     near k*Pi/2 and huge arguments, Inf and NaN
+//
+// Kernels branch on the size of x and go to slow paths on huge ones, so
+// each of these times and errs differently; benchmark reports them one
+// by one.
+
+#ifndef DISTRIB_H
+#define DISTRIB_H
+
+#include <gsl/gsl_rng.h>
+
+enum { DIST_FLAT, DIST_LOG, DIST_HALFPI, DIST_SWEEP, DIST_FILE, DIST_SPECIAL, DIST_KINDS };
+
+struct distrib {
+  int           kind;
+  const char   *spec;           // as given to -D
+  double        lo, hi;         // exponents, for log and halfpi
+  double       *data;           // the file's points
+  long          n;
+  long          next;
+};
+
+// Parse a -D spec, reading the file for file:path; prints why and
+// returns -1 when it can't.
+int dist_parse(struct distrib *d, const char *spec);
+// Fill x[0..points) from d, with min and max for the kinds that use them.
+void dist_fill(struct distrib *d, gsl_rng *r, double *x, int points,
+               double min_x, double max_x);
+void dist_free(struct distrib *d);
+
+#endif
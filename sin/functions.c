@@ -0,0 +1,231 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <dlfcn.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#include <gsl/gsl_sf_trig.h>
+
+#include "mysin.h"
+#include "functions.h"
+#include "kernel.h"
+
+static double sinf_3_d(double x) { return sinf_3((float)x); }
+static double sinf_d(double x) { return sinf((float)x); }
+static double sin_dd_hi(double x) {
+  double hi, lo;
+  sin_dd(x, &hi, &lo);
+  return hi;
+}
+
+static struct function_item builtin_functions[] = {
+  {"sin1",      &sin_1,      NULL},
+  {"sin2",      &sin_2,      NULL},
+  {"sin3",      &sin_3,      &sin_3_batch},
+  {"sin3b",     &sin_3b,     NULL},
+  {"sin3e",     &sin_3e,     NULL},
+  {"sin4",      &sin_4,      NULL},
+  {"sin5",      &sin_5,      NULL},
+  {"sin5_64",   &sin_5_64,   NULL},
+  {"sin5_256",  &sin_5_256,  NULL},
+  {"sincr",     &sin_cr,     NULL},
+  {"sincr_fast", &sin_cr_fast, NULL},
+  {"sindd",     &sin_dd_hi,  NULL},
+  {"approx2_7",  &sin_approx_pi2_7,  NULL},
+  {"approx2_9",  &sin_approx_pi2_9,  NULL},
+  {"approx2_11", &sin_approx_pi2_11, NULL},
+  {"approx2_13", &sin_approx_pi2_13, NULL},
+  {"approx2_15", &sin_approx_pi2_15, NULL},
+  {"approx4_7",  &sin_approx_pi4_7,  NULL},
+  {"approx4_9",  &sin_approx_pi4_9,  NULL},
+  {"approx4_11", &sin_approx_pi4_11, NULL},
+  {"approx4_13", &sin_approx_pi4_13, NULL},
+  {"sinf3",     &sinf_3_d,   NULL, &sinf_3, &sinf_3_batch},
+  {"sinf",      &sinf_d,     NULL, &sinf,   NULL},
+  {"gslsin",    &gsl_sf_sin, NULL},
+  {"reduce",    &reduce,     NULL, NULL, NULL, 0.0, NULL, 1},
+  {"gslReduce", &gslReduce,  NULL, NULL, NULL, 0.0, NULL, 1},
+  {"",          NULL,        NULL}
+};
+
+struct function_item *function_lookup = builtin_functions;
+static int n_functions = sizeof(builtin_functions) / sizeof(builtin_functions[0]) - 1;
+
+void list_functions() {
+  fprintf(stderr, "Available function options:\n");
+  for(int i = 0; function_lookup[i].f_ptr != NULL; i++) {
+    struct function_item *f = &function_lookup[i];
+    fprintf(stderr, "\t%s%s%s", f->f_name,
+            f->ff_ptr != NULL ? "\t(float)" : "",
+            f->batch_ptr != NULL || f->fbatch_ptr != NULL ? "\t(batch)" : "");
+    if (f->not_sin) fprintf(stderr, "\t(reduction)");
+    if (f->claimed_ulp > 0.0) fprintf(stderr, "\t(claims %g ulp)", f->claimed_ulp);
+    if (f->origin != NULL) fprintf(stderr, "\t(%s)", f->origin);
+    fprintf(stderr, "\n");
+  }
+}
+
+// Fill in *f from the table entry named f->f_name.  Returns 0 if there
+// is none.
+int find_function(struct function_item *f) {
+  for(int i = 0; function_lookup[i].f_ptr != NULL; i++) {
+    if( 0 == strcmp(f->f_name, function_lookup[i].f_name) ) {
+      *f = function_lookup[i];
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// Append f to the table, which is copied off the built-in one the
+// first time.
+static int add_function(const struct function_item *f) {
+  struct function_item *t = function_lookup == builtin_functions ? NULL : function_lookup;
+  t = realloc(t, (n_functions + 2) * sizeof(*t));
+  if (t == NULL) {
+    fprintf(stderr, "Unable to allocate memory.");
+    return -1;
+  }
+  if (function_lookup == builtin_functions) {
+    memcpy(t, builtin_functions, n_functions * sizeof(*t));
+  }
+  t[n_functions++] = *f;
+  t[n_functions] = (struct function_item){"", NULL, NULL};
+  function_lookup = t;
+  return 0;
+}
+
+// The kernels of one shared object.  In a directory (quiet) files
+// without them are passed over; named on their own they are an error.
+static int load_kernel_file(const char *path, int quiet) {
+  // dlopen searches the library path for a bare file name
+  char local[4096];
+  snprintf(local, sizeof(local), "%s%s", strchr(path, '/') == NULL ? "./" : "", path);
+  void *handle = dlopen(local, RTLD_NOW | RTLD_LOCAL);
+  if (handle == NULL) {
+    if (quiet) return 0;
+    fprintf(stderr, "%s\n", dlerror());
+    return -1;
+  }
+  const int *version = dlsym(handle, "sin_kernels_version");
+  const struct sin_kernel *k = dlsym(handle, "sin_kernels");
+  if (version == NULL || k == NULL) {
+    dlclose(handle);
+    if (quiet) return 0;
+    fprintf(stderr, "%s: no sin_kernels, see kernel.h.\n", path);
+    return -1;
+  }
+  if (*version != SIN_KERNEL_VERSION) {
+    fprintf(stderr, "%s: sin_kernels version %d, expected %d.\n", path, *version,
+            SIN_KERNEL_VERSION);
+    dlclose(handle);
+    return -1;
+  }
+
+  for (const struct sin_kernel *e = k; e->name != NULL; e++) {
+    if (e->f == NULL || (e->mant_bits != 53 && e->mant_bits != 24) ||
+        (e->mant_bits == 24 && e->ff == NULL)) {
+      fprintf(stderr, "%s: %s needs f, and ff for mant_bits 24.\n", path, e->name);
+      dlclose(handle);
+      return -1;
+    }
+  }
+
+  // file name without directory or extension, for names already taken
+  const char *base = strrchr(path, '/') != NULL ? strrchr(path, '/') + 1 : path;
+  int base_len = strcspn(base, ".");
+
+  int first = n_functions;
+  for (const struct sin_kernel *e = k; e->name != NULL; e++) {
+    struct function_item f = {e->name, e->f, e->batch, NULL, NULL, e->max_ulp, path};
+    if (e->mant_bits == 24) {
+      f.batch_ptr = NULL;
+      f.ff_ptr = e->ff;
+      f.fbatch_ptr = e->fbatch;
+    }
+    struct function_item taken = {e->name};
+    if (find_function(&taken)) {
+      char *name = malloc(strlen(e->name) + base_len + 2);
+      if (name != NULL) sprintf(name, "%s@%.*s", e->name, base_len, base);
+      f.f_name = name;
+    }
+    if (f.f_name == NULL) fprintf(stderr, "Unable to allocate memory.");
+    if (f.f_name == NULL || add_function(&f) != 0) {
+      // take this file's kernels out again before closing it
+      for (int i = first; i < n_functions; i++) {
+        if (function_lookup[i].f_name != k[i - first].name) free((char *)function_lookup[i].f_name);
+      }
+      if (f.f_name != e->name) free((char *)f.f_name);
+      n_functions = first;
+      function_lookup[n_functions] = (struct function_item){"", NULL, NULL};
+      dlclose(handle);
+      return -1;
+    }
+  }
+  return n_functions - first;
+}
+
+static int has_suffix(const char *s, const char *suffix) {
+  size_t n = strlen(s), m = strlen(suffix);
+  return n > m && strcmp(s + n - m, suffix) == 0;
+}
+
+static int load_kernel_dir(const char *dir) {
+  struct dirent **entries;
+  int n = scandir(dir, &entries, NULL, alphasort);
+  if (n < 0) {
+    perror(dir);
+    return -1;
+  }
+  int added = 0;
+  for (int i = 0; i < n; i++) {
+    const char *name = entries[i]->d_name;
+    if (added >= 0 && (has_suffix(name, ".so") || has_suffix(name, ".dylib"))) {
+      char *path = malloc(strlen(dir) + strlen(name) + 2);
+      if (path == NULL) {
+        fprintf(stderr, "Unable to allocate memory.");
+        added = -1;
+      } else {
+        sprintf(path, "%s/%s", dir, name);
+        int k = load_kernel_file(path, 1);
+        added = k < 0 ? -1 : added + k;
+      }
+    }
+    free(entries[i]);
+  }
+  free(entries);
+  return added;
+}
+
+// The paths are kept, as the origin of the kernels.
+int load_kernels(const char *paths) {
+  if (paths == NULL) return 0;
+  int added = 0;
+  while (*paths != '\0') {
+    size_t len = strcspn(paths, ":");
+    char *path = strndup(paths, len);
+    if (path == NULL) {
+      fprintf(stderr, "Unable to allocate memory.");
+      return -1;
+    }
+    struct stat st;
+    int k;
+    if (len == 0) {
+      k = 0;
+    } else if (stat(path, &st) != 0) {
+      perror(path);
+      k = -1;
+    } else if (S_ISDIR(st.st_mode)) {
+      k = load_kernel_dir(path);
+    } else {
+      k = load_kernel_file(path, 0);
+    }
+    if (k < 0) return -1;
+    added += k;
+    paths += len;
+    if (*paths == ':') paths++;
+  }
+  return added;
+}
@@ -0,0 +1,36 @@
+// functions.h
+// The table of Sin functions that benchmark and ulp know by name: the
+// ones linked in, then any loaded from shared objects (kernel.h).
+
+#ifndef FUNCTIONS_H
+#define FUNCTIONS_H
+
+#include <stddef.h>
+
+typedef double (*f_ptr)(double);
+typedef void (*batch_ptr)(const double *, double *, size_t);
+typedef float (*ff_ptr)(float);
+typedef void (*fbatch_ptr)(const float *, float *, size_t);
+
+struct function_item {
+  const char*   f_name;
+  f_ptr         f_ptr;
+  batch_ptr     batch_ptr;
+  ff_ptr        ff_ptr;         // single precision: timed through these,
+  fbatch_ptr    fbatch_ptr;     //   f_ptr is a double wrapper for -x
+  double        claimed_ulp;    // max error claimed by a loaded kernel, or 0
+  const char   *origin;         // the file it came from, NULL if linked in
+  int           not_sin;        // an angle reduction, timed but not a Sin
+};
+
+// Ends with an entry whose f_ptr is NULL.
+extern struct function_item *function_lookup;
+
+void list_functions();
+int find_function(struct function_item *f);
+// Add the kernels of each shared object in paths, separated by ':'; a
+// directory adds all the .so and .dylib files in it that have kernels.
+// Returns how many were added, or -1 after printing why not.
+int load_kernels(const char *paths);
+
+#endif
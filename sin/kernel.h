@@ -0,0 +1,34 @@
+// kernel.h
+// How a shared object offers Sin kernels to benchmark and ulp without
+// relinking them (-K, or MYSIN_KERNELS): it exports
+//
+//   const int sin_kernels_version = SIN_KERNEL_VERSION;
+//   const struct sin_kernel sin_kernels[] = {
+//     {"mysin", &my_sin, &my_sin_batch, NULL, NULL, 53, 1.0},
+//     {NULL}
+//   };
+//
+// and is built with -shared (-dynamiclib on macOS).  Names that are
+// taken already get @ and the file name added, so an experimental
+// build of a kernel can be timed against the one in libmysin.
+// kernel_libm.c is an example.
+
+#ifndef KERNEL_H
+#define KERNEL_H
+
+#include <stddef.h>
+
+#define SIN_KERNEL_VERSION 1
+
+struct sin_kernel {
+  const char   *name;           // NULL ends the array
+  double      (*f)(double);     // always; for float kernels a double
+                                //   wrapper, used by -x
+  void        (*batch)(const double *, double *, size_t);   // or NULL
+  float       (*ff)(float);     // float kernels only
+  void        (*fbatch)(const float *, float *, size_t);    // or NULL
+  int           mant_bits;      // 53 for double, 24 for float
+  double        max_ulp;        // the error claimed, 0 for no claim
+};
+
+#endif
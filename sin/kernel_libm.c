@@ -0,0 +1,22 @@
+// An example of kernels loaded at run time (kernel.h): the C library's
+// sin and sinf, as "libm" and "libmf".
+//
+//   benchmark -K libsin_libm.so -A libm -B sin5
+
+#include <math.h>
+
+#include "kernel.h"
+
+static double sinf_d(double x) { return sinf((float)x); }
+
+static void sin_batch(const double *x, double *y, size_t n) {
+  for (size_t i = 0; i < n; i++) y[i] = sin(x[i]);
+}
+
+const int sin_kernels_version = SIN_KERNEL_VERSION;
+
+const struct sin_kernel sin_kernels[] = {
+  {"libm",  &sin,    &sin_batch, NULL,  NULL, 53, 1.0},
+  {"libmf", &sinf_d, NULL,       &sinf, NULL, 24, 1.0},
+  {NULL}
+};
@@ -1,6 +1,91 @@
+#include <stddef.h>
+#include <stdint.h>
+
 extern double sin_1(double x);
 extern double sin_2(double x);
 extern double sin_3(double x);
+// sin_3 with no branches but one, rarely taken, for tiny, huge, Inf
+// and NaN; exactly x for |x| < 2^-26
+extern double sin_3b(double x);
+// sin_3 with the polynomial evaluated by Estrin's scheme
+extern double sin_3e(double x);
+// odd polynomial x + x^3*P(x^2), same reduction as sin_3
+extern double sin_4(double x);
+// table-driven: Sin and Cos at the nearest of N+1 nodes on [0, Pi/4]
+// and degree 5/6 corrections, N = 128 (sin_5), 64 or 256
+extern double sin_5(double x);
+extern double sin_5_64(double x);
+extern double sin_5_256(double x);
+// correctly rounded (sin_cr.c): sin_5 in double-double with Ziv's
+// rounding test, and a 128 bit pass when that fails.  sin_cr_fast is
+// the first pass alone, and sin_cr_counts reads how many sin_cr calls
+// took the second, and how many of those were still too close to call.
+extern double sin_cr(double x);
+extern double sin_cr_fast(double x);
+extern void sin_cr_counts(uint64_t *slow, uint64_t *undecided);
+// Sin(x) = *hi + *lo to 2^-100 relative, for compensated sums
+// (sin_dd.c); the batch form does n of them.
+extern void sin_dd(double x, double *hi, double *lo);
+extern void sin_dd_batch(const double *x, double *hi, double *lo, size_t n);
+// Sin and Cos with one reduction; *s is sin_3(x)
+extern void sincos_3(double x, double *s, double *c);
+// single precision: float Cody-Waite below 2^18, separate Sin and
+// Cos polynomials on [0, Pi/4]
+extern float sinf_3(float x);
+// sin_approx.h instances: degree 7..15 on [0, Pi/2] (pi2) or
+// Sin and Cos polynomials on [0, Pi/4] (pi4)
+extern double sin_approx_pi2_7(double x);
+extern double sin_approx_pi2_9(double x);
+extern double sin_approx_pi2_11(double x);
+extern double sin_approx_pi2_13(double x);
+extern double sin_approx_pi2_15(double x);
+extern double sin_approx_pi4_7(double x);
+extern double sin_approx_pi4_9(double x);
+extern double sin_approx_pi4_11(double x);
+extern double sin_approx_pi4_13(double x);
 
 extern double gslReduce(double x);
+// x - n*Pi/2 with n = round(x*2/Pi)
 extern double reduce(double x);
+
+// Both reductions return n mod 4 with x = n*Pi/2 + (*hi + *lo).
+// Cody-Waite, for |x| < 2^20:
+extern int cwReduce(double x, double *hi, double *lo);
+// Payne-Hanek, for any x:
+extern int phReduce(double x, double *hi, double *lo);
+// Payne-Hanek to 128 bits, for sin_cr: the remainder is
+// (-1)^*neg * *r * 2^(*exp - 127), with the top bit of *r set (or
+// *r = 0).
+extern int phReduce128(double x, int *neg, unsigned __int128 *r, int *exp);
+// 64 bits of 2/Pi from bit s on, bit 0 being worth 1/2; for nearpi.
+extern uint64_t two_over_pi_bits(int s);
+
+// Array versions: y[i] = sin_3(x[i]) for i < n.
+extern void sin_3_batch(const double *x, double *y, size_t n);
+// s[i], c[i] = sincos_3(x[i]) for i < n.
+extern void sincos_3_batch(const double *x, double *s, double *c, size_t n);
+// y[i] = sinf_3(x[i]) for i < n.
+extern void sinf_3_batch(const float *x, float *y, size_t n);
+// The batch kernels above, and on x86-64 sin_3 and the other scalar
+// kernels, are bound at load time to the widest set of instructions
+// the CPU has (dispatch.c); MYSIN_ISA=scalar|neon|avx2|avx512 picks a
+// lower one.  sin_isa() says which.
+enum { SIN_ISA_SCALAR, SIN_ISA_NEON, SIN_ISA_AVX2, SIN_ISA_AVX512 };
+extern int sin_isa(void);
+extern const char *sin_isa_name(void);
+extern void sin_3_batch_scalar(const double *x, double *y, size_t n);
+extern void sincos_3_batch_scalar(const double *x, double *s, double *c, size_t n);
+extern void sinf_3_batch_scalar(const float *x, float *y, size_t n);
+#if defined(__aarch64__)
+extern void sin_3_batch_neon(const double *x, double *y, size_t n);
+extern void sincos_3_batch_neon(const double *x, double *s, double *c, size_t n);
+extern void sinf_3_batch_neon(const float *x, float *y, size_t n);
+#endif
+#if defined(__x86_64__)
+extern void sin_3_batch_avx2(const double *x, double *y, size_t n);
+extern void sin_3_batch_avx512(const double *x, double *y, size_t n);
+extern void sincos_3_batch_avx2(const double *x, double *s, double *c, size_t n);
+extern void sincos_3_batch_avx512(const double *x, double *s, double *c, size_t n);
+extern void sinf_3_batch_avx2(const float *x, float *y, size_t n);
+extern void sinf_3_batch_avx512(const float *x, float *y, size_t n);
+#endif
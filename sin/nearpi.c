@@ -0,0 +1,186 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "mysin.h"
+
+char* help_string =
+  "nearpi - The doubles closest to multiples of Pi/2, binade by binade.\n"
+  "usage: nearpi [-h]\n"
+  "       nearpi [-e min,max] [-v] [output]\n\n"
+  "    -e min,max          Binades [2^min, 2^(min+1)) to [2^max, 2^(max+1)).\n"
+  "                        Default 0,1023, all those with a multiple of Pi/2.\n"
+  "    -v                  Print each point, its n mod 4 and its remainder\n"
+  "                        x - n*Pi/2.\n"
+  "    -h                  Display this help.\n\n"
+  "For each binade writes the double just above a multiple of Pi/2 and the\n"
+  "one just below, the two with the smallest remainder, as raw doubles to\n"
+  "output (default stdout) for benchmark -D file:path and ulp -D file:path.\n"
+  "These are where a reduction loses the most bits to cancellation.  The\n"
+  "smallest of all is about 2^-61, at 6381956970095103 * 2^797.\n";
+
+// The search in refs/nearpi.c, by Kahan and McDonald, doubles a
+// continued fraction of Pi from one binade to the next.  We take the
+// same problem from the bits of 2/Pi that phReduce uses instead: in
+// the binade [2^e, 2^(e+1)) the doubles are m*2^(e-52), 2^52 <= m <
+// 2^53, and x*2/Pi is m*a for a = 2^(e-52)*2/Pi.  Only the fractions
+// matter, so with m = 2^52 + k we want the k < 2^52 where
+// frac(b + k*a), b = frac(2^52*a), is smallest (x just above n*Pi/2),
+// and where it is largest (just below).
+//
+// The points frac(k*a), k < n, split the circle into gaps of two
+// lengths whenever n = u + v, where frac(u*a) = x is the point nearest
+// above 0 and frac(v*a) = 1 - y the one nearest below.  Going to the
+// next such n puts a new point into every gap of the longer length,
+// the shorter length from its start (Stern-Brocot).  We follow the gap
+// that holds -b, and the point that ends it is the answer once n
+// passes 2^52.  Fractions are 128 bit fixed point, wrapping mod 1.
+
+typedef unsigned __int128 u128;
+
+// The k < N with frac(b + k*a) smallest; returns that fraction.
+//
+// Near 0 and Pi/2 the steps repeat ~2^52 times (x or y is tiny), so
+// each branch first takes, all at once, the steps before the next one
+// that behaves differently, then one step as written.
+static u128 smallest(u128 a, u128 b, uint64_t N, uint64_t *k) {
+  u128 x = a, y = -a;           // frac(u*a) and 1 - frac(v*a)
+  uint64_t u = 1, v = 1;
+  u128 d = b;                   // frac(b + k*a), from -b up to point k
+  *k = 0;
+  if (N > 1 && d >= y) {        // points 0 and 1
+    d -= y;
+    *k = 1;
+  }
+  for (;;) {
+    uint64_t n = u + v;
+    if (x < y) {
+      // New points k + u + v, y - x below the end of each y gap, which
+      // are the gaps ending at k < u.  Once k moves it is >= u.
+      u128 s = y / x - 1;
+      if (s > (N - n) / u) s = (N - n) / u;
+      if (*k < u && d < y - x && s > (y - x - d - 1) / x + 1) s = (y - x - d - 1) / x + 1;
+      if (*k < u && d >= y - x) s = 0;
+      y -= s * x;
+      v += (uint64_t)s * u;
+      n = u + v;
+
+      if (*k < u && d >= y - x && *k + u + v < N) {
+        d -= y - x;
+        *k += u + v;
+      }
+      if (n + u > N) break;
+      y -= x;
+      v += u;
+    } else {
+      // New points k + v, y below the end of each x gap (k >= u).  k
+      // moves every step until d < y, and then no more.
+      u128 s = x / y - 1;
+      if (s > (N - n) / v) s = (N - n) / v;
+      if (*k >= u && d >= y) {
+        u128 f = s;
+        if (f > d / y) f = d / y;
+        u128 room = *k + v < N ? (N - 1 - *k - v) / v + 1 : 0;
+        if (f > room) f = room;
+        d -= f * y;
+        *k += (uint64_t)f * v;
+      }
+      x -= s * y;
+      u += (uint64_t)s * v;
+      n = u + v;
+
+      if (*k >= u && d >= y && *k + v < N) {
+        d -= y;
+        *k += v;
+      }
+      if (n + v > N) break;
+      x -= y;
+      u += v;
+    }
+  }
+  return d;
+}
+
+static double fraction(u128 f) {
+  return ldexp((double)f, -128);
+}
+
+int main(int argc, char **argv) {
+  int min_e = 0, max_e = 1023;
+  int verbose = 0;
+
+  int c;
+  while ((c = getopt(argc, argv, "e:vh")) != -1) {
+    switch (c) {
+    case 'e':
+      if (sscanf(optarg, "%d,%d", &min_e, &max_e) != 2) {
+        fprintf(stderr, "Please specify -e min,max.\n");
+        exit(1);
+      }
+      break;
+    case 'v':
+      verbose = 1;
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(1);
+    }
+  }
+  if (min_e < 0 || max_e > 1023 || min_e > max_e) {
+    fprintf(stderr, "Please specify binades 0 <= min <= max <= 1023.\n");
+    exit(1);
+  }
+  FILE *out = stdout;
+  if (optind < argc) {
+    out = fopen(argv[optind], "wb");
+    if (out == NULL) {
+      perror(argv[optind]);
+      exit(1);
+    }
+  }
+
+  FILE *table = out == stdout ? stderr : stdout;
+  const uint64_t N = 1ULL << 52;
+  double worst_x = 0.0, worst_r = INFINITY;
+  if (verbose) {
+    fprintf(table, "%5s %24s %18s %2s %24s %8s\n", "e", "x", "", "n", "x - n*Pi/2", "log2");
+  }
+  for (int e = min_e; e <= max_e; e++) {
+    u128 a = (u128)two_over_pi_bits(e - 52) << 64 | two_over_pi_bits(e + 12);
+    u128 b = (u128)two_over_pi_bits(e) << 64 | two_over_pi_bits(e + 64);
+    uint64_t k[2];
+    u128 d[2];
+    d[0] = smallest(a, b, N, &k[0]);    // just above
+    d[1] = smallest(-a, -b, N, &k[1]);  // just below
+
+    for (int s = 0; s < 2; s++) {
+      double x = ldexp((double)(N + k[s]), e - 52);
+      if (fwrite(&x, sizeof(x), 1, out) != 1) {
+        perror("nearpi");
+        exit(1);
+      }
+      double hi, lo;
+      int n = phReduce(x, &hi, &lo);
+      if (fabs(hi) < worst_r) {
+        worst_r = fabs(hi);
+        worst_x = x;
+      }
+      if (verbose) {
+        fprintf(table, "%5d %24.17g %18a %2d %+24.17g %8.2f\n", e, x, x, n, hi,
+                log2(fraction(d[s]) * M_PI_2));
+      }
+    }
+  }
+  if (out != stdout && fclose(out) != 0) {
+    perror(argv[optind]);
+    exit(1);
+  }
+  fprintf(stderr, "%d points; the closest, %.17g, is %.4g (2^%.2f) from a multiple of Pi/2\n",
+          2 * (max_e - min_e + 1), worst_x, worst_r, log2(worst_r));
+  return 0;
+}
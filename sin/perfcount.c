@@ -0,0 +1,112 @@
+#include <math.h>
+#include <string.h>
+#include <errno.h>
+#if defined(__linux__)
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+#include "perfcount.h"
+
+const char *perf_names[PERF_COUNTERS] = {
+  "cycles", "instr", "br-miss", "L1D-miss", "div-busy"
+};
+
+static const char *error = "not available on this system";
+
+#if defined(__linux__)
+
+static int fds[PERF_COUNTERS] = {-1, -1, -1, -1, -1};
+
+static int open_counter(uint32_t type, uint64_t config) {
+  struct perf_event_attr attr;
+  memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = type;
+  attr.config = config;
+  attr.disabled = 1;
+  attr.exclude_kernel = 1;      // allowed at perf_event_paranoid 2
+  attr.exclude_hv = 1;
+  attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+int perf_open(void) {
+  fds[PERF_CYCLES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+  fds[PERF_INSTRUCTIONS] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+  fds[PERF_BRANCH_MISSES] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+  fds[PERF_L1D_MISSES] = open_counter(PERF_TYPE_HW_CACHE,
+                                      PERF_COUNT_HW_CACHE_L1D |
+                                      PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                                      PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  int open_errno = errno;
+#if defined(__x86_64__)
+  // ARITH.DIVIDER_ACTIVE (event 0x14, umask 0x01, cmask 1), Skylake on;
+  // other CPUs have no common event for it.
+  __builtin_cpu_init();
+  if (__builtin_cpu_is("intel")) {
+    fds[PERF_DIV_STALLS] = open_counter(PERF_TYPE_RAW, 0x14 | 0x01 << 8 | 1 << 24);
+  }
+#endif
+
+  int n = 0;
+  for (int i = 0; i < PERF_COUNTERS; i++) n += fds[i] >= 0;
+  if (n == 0) {
+    error = open_errno == EACCES || open_errno == EPERM
+      ? "not permitted, see /proc/sys/kernel/perf_event_paranoid"
+      : strerror(open_errno);
+  }
+  return n;
+}
+
+void perf_close(void) {
+  for (int i = 0; i < PERF_COUNTERS; i++) {
+    if (fds[i] >= 0) close(fds[i]);
+    fds[i] = -1;
+  }
+}
+
+void perf_measure(uint64_t (*pass)(void *), void *ctx, double calls, int passes,
+                  struct perf_counts *c) {
+  for (int i = 0; i < PERF_COUNTERS; i++) {
+    if (fds[i] < 0) continue;
+    ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+    ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+  }
+  for (int p = 0; p < passes; p++) pass(ctx);
+  for (int i = 0; i < PERF_COUNTERS; i++) {
+    if (fds[i] >= 0) ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+  }
+
+  // The kernel shares the hardware counters out in turns when there
+  // are more events than counters; scale up by the time each ran.
+  for (int i = 0; i < PERF_COUNTERS; i++) {
+    uint64_t v[3];              // value, time enabled, time running
+    c->per_call[i] = NAN;
+    if (fds[i] < 0 || read(fds[i], v, sizeof(v)) != sizeof(v) || v[2] == 0) continue;
+    c->per_call[i] = (double)v[0] * v[1] / v[2] / (calls * passes);
+  }
+}
+
+#else
+
+int perf_open(void) {
+  return 0;
+}
+
+void perf_close(void) {
+}
+
+void perf_measure(uint64_t (*pass)(void *), void *ctx, double calls, int passes,
+                  struct perf_counts *c) {
+  (void)pass, (void)ctx, (void)calls, (void)passes;
+  for (int i = 0; i < PERF_COUNTERS; i++) c->per_call[i] = NAN;
+}
+
+#endif
+
+const char *perf_error(void) {
+  return error;
+}
@@ -0,0 +1,41 @@
+// perfcount.h
+// Hardware performance counters for benchmark, through perf_event_open
+// on Linux.
+//
+// perf_open() asks for each counter separately, so that one the CPU,
+// the kernel (perf_event_paranoid) or a VM won't give doesn't take the
+// others with it; the ones missing are reported as unavailable, and on
+// other systems all of them are.  perf_measure() counts user-space
+// events over a few passes and divides by the calls.
+
+#ifndef PERFCOUNT_H
+#define PERFCOUNT_H
+
+#include <stdint.h>
+
+enum {
+  PERF_CYCLES,
+  PERF_INSTRUCTIONS,
+  PERF_BRANCH_MISSES,
+  PERF_L1D_MISSES,
+  PERF_DIV_STALLS,              // cycles the divider is busy, Intel only
+  PERF_COUNTERS
+};
+
+extern const char *perf_names[PERF_COUNTERS];
+
+struct perf_counts {
+  double        per_call[PERF_COUNTERS];  // NAN where unavailable
+};
+
+// Open the counters; returns how many are available.
+int perf_open(void);
+// Why none are, when perf_open() returned 0.
+const char *perf_error(void);
+void perf_close(void);
+
+// Count over `passes` calls of pass(ctx), each making `calls` calls.
+void perf_measure(uint64_t (*pass)(void *), void *ctx, double calls, int passes,
+                  struct perf_counts *c);
+
+#endif
@@ -1,5 +1,5 @@
 // reduce.s
-// Approximate Sin(x) by Chebyshev approximation
+// Reduce x to r = x - n*Pi/2, n = round(x*2/Pi), |r| <= Pi/4
 
 .global         _reduce
 .p2align        2		// Make sure everything is aligned properly
@@ -13,30 +13,39 @@
 .text
 
 _reduce:
-        mov     w1, wzr         // we're going to use w1 to keep some flags
-        fmov    d4, #2          // we're going to mulitply & divide by 2 later
-        fcmp    d0, #0.0
-        bge     pos             // x < 0, return -Sin(-x)
-        mov     w1, 0x0001      // 1 in w1 bit 1 will mean negate the result at the end
-        fneg    d0, d0
-pos:
-        LOADVAL d1, c2Pi        // d1 = 2*Pi
-        fcmp    d0, d1
-        ble     inrange
-        fdiv    d3, d0, d1      // d0 > 2*Pi
-        frintz  d3, d3          // floor
-        fmsub   d0, d3, d1, d0
-inrange:
-        and     w1, w1, 0x0001
-        cmp     w1, #0
-        beq     end
-        fneg    d0, d0
-        y
-end:
+        fabs    d1, d0
+        LOADVAL d2, cHuge       // |x| >= 2^20 goes to Payne-Hanek
+        fcmp    d1, d2
+        bge     huge
+
+        // Cody-Waite, the leading word of cwReduce in angle_reduction.c
+        LOADVAL d1, c2DPi
+        LOADVAL d2, cToInt
+        fmadd   d3, d0, d1, d2  // d3 = x*2/Pi + 1.5*2^52
+        fsub    d3, d3, d2      // d3 = n
+        LOADVAL d1, cPiD2_1
+        fmsub   d0, d3, d1, d0  // d0 = x - n*PiD2_1, exact
+        LOADVAL d1, cPiD2_2
+        fmsub   d0, d3, d1, d0  // d0 = d0 - n*PiD2_2
+        LOADVAL d1, cPiD2_3
+        fmsub   d0, d3, d1, d0  // d0 = d0 - n*PiD2_3
+        ret
+
+huge:
+        stp     x29, x30, [sp, #-32]!
+        mov     x29, sp
+        add     x0, sp, #16     // &hi
+        add     x1, sp, #24     // &lo
+        bl      _phReduce
+        ldr     d0, [sp, #16]
+        ldp     x29, x30, [sp], #32
         ret
 
 .p2align        2
 .data
-c2Pi:   .double +6.28318530717958647692529
-cPi:    .double +3.14159265358979323846264
-cPiD2:  .double +1.57079632679489661923132
+c2DPi:  .double +6.36619772367581382433e-01     // 2/Pi
+cToInt: .double +6755399441055744.0             // 1.5*2^52
+cPiD2_1: .double +1.57079632679489655800e+00    // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+cPiD2_2: .double +6.12323399573676603587e-17
+cPiD2_3: .double -1.49738490485916983294e-33
+cHuge:  .double +1048576.0
@@ -0,0 +1,543 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "dd.h"
+
+char* help_string =
+  "remez - Minimax polynomial coefficients for Sin(x) and Cos(x).\n"
+  "usage: remez [-h]\n"
+  "       remez [-d degree] [-m min -M max] [-o | -c] [-f] [-n name] [-s [-l label]]\n\n"
+  "    -d degree           Degree of the polynomial.\n"
+  "                        Default 13\n"
+  "    -m min -M max       Interval of x to fit.\n"
+  "                        Defaults min=0 max=Pi/2\n"
+  "    -o                  Odd polynomial: Sin(x) ~ x + x^3*P(x^2), minimax for the\n"
+  "                        relative error.  Otherwise Sin(x) ~ P(x), minimax for the\n"
+  "                        absolute error.  With -o, min must be >= 0 and degree odd.\n"
+  "    -c                  Even polynomial for Cos(x) ~ 1 + x^2*P(x^2), minimax for\n"
+  "                        the relative error.  The degree must be even and\n"
+  "                        0 <= min < max < Pi/2.\n"
+  "    -f                  Round the coefficients to float rather than double,\n"
+  "                        and write a float table or .float block.\n"
+  "    -n name             Name of the table.\n"
+  "                        Default sin_<degree>, sin_odd_<degree> with -o,\n"
+  "                        or cos_<degree> with -c\n"
+  "    -s                  Write an assembler .double block instead of a C header.\n"
+  "    -l label            Label prefix for -s, numbered from 0.\n"
+  "                        Default a\n"
+  "    -h                  Display this help.\n";
+
+// The fit is done in a variable t with a plain polynomial P(t) of
+// terms coefficients:
+//
+//   full:  t = x,    P(t) ~ F(t) = Sin(x),             weight 1
+//   odd:   t = x^2,  P(t) ~ F(t) = (Sin(x) - x)/x^3,   weight x^3/Sin(x)
+//   cos:   t = x^2,  P(t) ~ F(t) = (Cos(x) - 1)/x^2,   weight x^2/Cos(x)
+//
+// so that weight*(P - F) is the absolute error of P(x) in the first
+// case and the relative error of x + x^3*P(x^2) or 1 + x^2*P(x^2) in
+// the others.  All of
+// the exchange runs in double-double, so the coefficients come out
+// well below a double ulp before they're rounded.
+
+#define MAX_TERMS 24
+#define MAX_ITER 60
+#define CELLS (1 << 16)
+
+struct fit {
+  int           odd;
+  int           cosine;
+  int           single;
+  int           terms;
+  double        min_x;
+  double        max_x;
+  double        min_t;
+  double        max_t;
+  dd            c[MAX_TERMS];
+  double        coeff[MAX_TERMS];
+  double        level;
+  double        bound;
+  int           iterations;
+};
+
+// (Sin(x) - x)/x^3 = sum((-1)^k t^(k-1)/(2k+1)!), k >= 1
+static dd odd_target(double t) {
+  dd sum = dd_make(0.0, 0.0);
+  dd term = dd_make(1.0, 0.0);
+  for (int k = 1; k < 30; k++) {
+    term = dd_div(term, dd_make((2.0 * k) * (2.0 * k + 1), 0.0));
+    sum = (k & 1) ? dd_sub(sum, term) : dd_add(sum, term);
+    term = dd_mul_d(term, t);
+  }
+  return sum;
+}
+
+// (Cos(x) - 1)/x^2 = sum((-1)^k t^(k-1)/(2k)!), k >= 1
+static dd even_target(double t) {
+  dd sum = dd_make(0.0, 0.0);
+  dd term = dd_make(1.0, 0.0);
+  for (int k = 1; k < 30; k++) {
+    term = dd_div(term, dd_make((2.0 * k - 1) * (2.0 * k), 0.0));
+    sum = (k & 1) ? dd_sub(sum, term) : dd_add(sum, term);
+    term = dd_mul_d(term, t);
+  }
+  return sum;
+}
+
+static dd target(const struct fit *f, double t, dd *weight) {
+  dd s, c;
+  if (f->cosine) {
+    dd_sincos_taylor(dd_sqrt(dd_make(t, 0.0)), &s, &c);
+    *weight = dd_div(dd_make(t, 0.0), c);
+    return even_target(t);
+  }
+  if (!f->odd) {
+    dd_sincos_taylor(dd_make(t, 0.0), &s, &c);
+    *weight = dd_make(1.0, 0.0);
+    return s;
+  }
+  dd x = dd_sqrt(dd_make(t, 0.0));
+  dd_sincos_taylor(x, &s, &c);
+  *weight = t > 0.0 ? dd_div(dd_mul_d(x, t), s) : dd_make(0.0, 0.0);
+  return odd_target(t);
+}
+
+static dd poly(const dd *c, int terms, double t) {
+  dd p = c[terms - 1];
+  for (int k = terms - 2; k >= 0; k--) {
+    p = dd_add(dd_mul_d(p, t), c[k]);
+  }
+  return p;
+}
+
+// weight*(P(t) - F(t))
+static double error_at(const struct fit *f, const dd *c, double t) {
+  dd w;
+  dd F = target(f, t, &w);
+  return dd_to_double(dd_mul(w, dd_sub(poly(c, f->terms, t), F)));
+}
+
+// Solve the n x n system a*x = b in place, partial pivoting.
+static int solve(int n, dd a[][MAX_TERMS + 1], dd *b, dd *x) {
+  for (int col = 0; col < n; col++) {
+    int piv = col;
+    for (int r = col + 1; r < n; r++) {
+      if (fabs(a[r][col].hi) > fabs(a[piv][col].hi)) piv = r;
+    }
+    if (a[piv][col].hi == 0.0) return -1;
+    if (piv != col) {
+      for (int k = 0; k < n; k++) {
+        dd t = a[col][k]; a[col][k] = a[piv][k]; a[piv][k] = t;
+      }
+      dd t = b[col]; b[col] = b[piv]; b[piv] = t;
+    }
+    for (int r = col + 1; r < n; r++) {
+      dd m = dd_div(a[r][col], a[col][col]);
+      for (int k = col; k < n; k++) {
+        a[r][k] = dd_sub(a[r][k], dd_mul(m, a[col][k]));
+      }
+      b[r] = dd_sub(b[r], dd_mul(m, b[col]));
+    }
+  }
+  for (int r = n - 1; r >= 0; r--) {
+    dd s = b[r];
+    for (int k = r + 1; k < n; k++) {
+      s = dd_sub(s, dd_mul(a[r][k], x[k]));
+    }
+    x[r] = dd_div(s, a[r][r]);
+  }
+  return 0;
+}
+
+// P(t_i) + (-1)^i E/weight(t_i) = F(t_i) at the reference points.
+static int levelled(const struct fit *f, const double *ref, dd *c, double *level) {
+  const int n = f->terms + 1;
+  dd a[MAX_TERMS + 1][MAX_TERMS + 1];
+  dd b[MAX_TERMS + 1];
+  dd x[MAX_TERMS + 1];
+  for (int i = 0; i < n; i++) {
+    dd w;
+    b[i] = target(f, ref[i], &w);
+    dd p = dd_make(1.0, 0.0);
+    for (int k = 0; k < f->terms; k++) {
+      a[i][k] = p;
+      p = dd_mul_d(p, ref[i]);
+    }
+    a[i][f->terms] = dd_div(dd_make((i & 1) ? -1.0 : 1.0, 0.0), w);
+  }
+  if (solve(n, a, b, x) != 0) return -1;
+  for (int k = 0; k < f->terms; k++) c[k] = x[k];
+  *level = fabs(dd_to_double(x[f->terms]));
+  return 0;
+}
+
+// A zero of the error between two points where it changes sign.
+static double find_zero(const struct fit *f, const dd *c, double lo, double hi) {
+  double elo = error_at(f, c, lo);
+  for (int i = 0; i < 100 && lo < hi; i++) {
+    double mid = 0.5 * (lo + hi);
+    if (mid == lo || mid == hi) break;
+    double e = error_at(f, c, mid);
+    if ((e < 0) == (elo < 0)) {
+      lo = mid;
+      elo = e;
+    } else {
+      hi = mid;
+    }
+  }
+  return 0.5 * (lo + hi);
+}
+
+// Where |error| is largest on [lo, hi]: a scan, then golden section
+// around the best sample.
+static double find_extremum(const struct fit *f, const dd *c, double lo, double hi) {
+  const int samples = 32;
+  double best = lo, best_e = -1.0;
+  for (int i = 0; i <= samples; i++) {
+    double t = lo + (hi - lo) * i / samples;
+    double e = fabs(error_at(f, c, t));
+    if (e > best_e) {
+      best_e = e;
+      best = t;
+    }
+  }
+  double a = fmax(lo, best - (hi - lo) / samples);
+  double b = fmin(hi, best + (hi - lo) / samples);
+  const double g = 0.6180339887498949;
+  double x1 = b - g * (b - a), x2 = a + g * (b - a);
+  double e1 = fabs(error_at(f, c, x1)), e2 = fabs(error_at(f, c, x2));
+  for (int i = 0; i < 100 && b - a > 1e-17 * fabs(b); i++) {
+    if (e1 > e2) {
+      b = x2; x2 = x1; e2 = e1;
+      x1 = b - g * (b - a);
+      e1 = fabs(error_at(f, c, x1));
+    } else {
+      a = x1; x1 = x2; e1 = e2;
+      x2 = a + g * (b - a);
+      e2 = fabs(error_at(f, c, x2));
+    }
+  }
+  double t = e1 > e2 ? x1 : x2;
+  return fabs(error_at(f, c, t)) > best_e ? t : best;
+}
+
+static int remez(struct fit *f) {
+  const int n = f->terms + 1;
+  double ref[MAX_TERMS + 1];
+  double zero[MAX_TERMS + 2];
+  const double A = f->min_t, B = f->max_t;
+
+  // Start from the Chebyshev extrema.  The odd and cos fits' error
+  // vanishes at t = 0, so there the points are kept off the left end.
+  for (int i = 0; i < n; i++) {
+    if ((f->odd || f->cosine) && A == 0.0) {
+      ref[i] = B * (1.0 - cos((i + 1) * M_PI / n)) / 2;
+    } else {
+      ref[i] = A + (B - A) * (1.0 - cos(i * M_PI / (n - 1))) / 2;
+    }
+  }
+
+  for (f->iterations = 1; f->iterations <= MAX_ITER; f->iterations++) {
+    if (levelled(f, ref, f->c, &f->level) != 0) return -1;
+
+    zero[0] = A;
+    for (int i = 0; i + 1 < n; i++) {
+      zero[i + 1] = find_zero(f, f->c, ref[i], ref[i + 1]);
+    }
+    zero[n] = B;
+
+    double max_e = 0.0, min_e = INFINITY;
+    for (int i = 0; i < n; i++) {
+      ref[i] = find_extremum(f, f->c, zero[i], zero[i + 1]);
+      double e = fabs(error_at(f, f->c, ref[i]));
+      if (e > max_e) max_e = e;
+      if (e < min_e) min_e = e;
+    }
+    if (max_e - min_e <= 1e-6 * max_e) break;
+  }
+  if (f->iterations > MAX_ITER) f->iterations = MAX_ITER;
+
+  for (int k = 0; k < f->terms; k++) {
+    f->coeff[k] = f->single ? (float)dd_to_double(f->c[k]) : dd_to_double(f->c[k]);
+  }
+  return 0;
+}
+
+// Bound |Q(x) - Sin(x)| over the interval for the rounded coefficients,
+// where Q(x) is P(x) or x + x^3*P(x^2).  On each of CELLS cells a Taylor
+// expansion around the midpoint m with |d| <= r gives
+//
+//   |e(m+d)| <= |e(m)| + r|e'(m)| + r^2/2|e''(m)| + r^3/6|e'''(m)| + r^4/24 D4
+//
+// with the derivatives at m in double-double and D4 a bound on
+// |Q''''| + |Sin''''| from the absolute values of the coefficients.
+// For the odd fit the bound is divided by the smallest Sin(x) on the
+// cell; next to 0 it uses the series of x^2*(P(x^2) - F(x^2)) instead.
+// For the cos fit Q is 1 + x^2*P(x^2), compared with Cos, and the
+// bound is divided by the smallest Cos(x) on the cell.
+static double error_bound(const struct fit *f) {
+  double q[2 * MAX_TERMS + 2];
+  int deg;
+  memset(q, 0, sizeof(q));
+  if (f->cosine) {
+    q[0] = 1.0;
+    for (int k = 0; k < f->terms; k++) q[2 * k + 2] = f->coeff[k];
+    deg = 2 * f->terms;
+  } else if (f->odd) {
+    q[1] = 1.0;
+    for (int k = 0; k < f->terms; k++) q[2 * k + 3] = f->coeff[k];
+    deg = 2 * f->terms + 1;
+  } else {
+    for (int k = 0; k < f->terms; k++) q[k] = f->coeff[k];
+    deg = f->terms - 1;
+  }
+
+  const double M = fmax(fabs(f->min_x), fabs(f->max_x));
+  double D4 = 1.0;
+  for (int k = 4; k <= deg; k++) {
+    D4 += fabs(q[k]) * k * (k - 1) * (k - 2) * (k - 3) * pow(M, k - 4);
+  }
+
+  const double h = (f->max_x - f->min_x) / CELLS;
+  const double r = h / 2;
+  double bound = 0.0;
+  for (int i = 0; i < CELLS; i++) {
+    double lo = f->min_x + i * h;
+    double m = lo + r;
+
+    if (f->odd && lo == 0.0) {
+      // |x^2 (P(x^2) - F(x^2))| / (1 - x^2/6) on [0, h]
+      double t = h * h;
+      double e = fabs(f->coeff[0] + 1.0 / 6.0);
+      double fact = 6.0, tk = 1.0;
+      for (int k = 1; k < 30; k++) {
+        fact *= (2 * k + 2) * (2 * k + 3);
+        tk *= t;
+        e += ((k < f->terms ? fabs(f->coeff[k]) : 0.0) + 1.0 / fact) * tk;
+      }
+      double b = t * e / (1.0 - t / 6.0);
+      if (b > bound) bound = b;
+      continue;
+    }
+
+    // Q^(j)(m)/j! for j = 0..3
+    dd d[4];
+    for (int j = 0; j < 4; j++) d[j] = dd_make(0.0, 0.0);
+    for (int k = deg; k >= 0; k--) {
+      d[3] = dd_add(dd_mul_d(d[3], m), d[2]);
+      d[2] = dd_add(dd_mul_d(d[2], m), d[1]);
+      d[1] = dd_add(dd_mul_d(d[1], m), d[0]);
+      d[0] = dd_add_d(dd_mul_d(d[0], m), q[k]);
+    }
+    d[2] = dd_mul_d(d[2], 2.0);
+    d[3] = dd_mul_d(d[3], 6.0);
+    dd s, c;
+    dd_sincos_taylor(dd_make(m, 0.0), &s, &c);
+    if (f->cosine) {
+      // Cos, -Sin, -Cos, Sin
+      dd t = s;
+      s = c;
+      c = dd_neg(t);
+    }
+    double e0 = fabs(dd_to_double(dd_sub(d[0], s)));
+    double e1 = fabs(dd_to_double(dd_sub(d[1], c)));
+    double e2 = fabs(dd_to_double(dd_add(d[2], s)));
+    double e3 = fabs(dd_to_double(dd_add(d[3], c)));
+    double b = e0 + r * e1 + r * r / 2 * e2 + r * r * r / 6 * e3 + r * r * r * r / 24 * D4;
+    if (f->cosine) {
+      dd s_hi, c_hi;
+      dd_sincos_taylor(dd_make(lo + h, 0.0), &s_hi, &c_hi);
+      b /= dd_to_double(c_hi);
+    } else if (f->odd) {
+      dd s_lo, c_lo;
+      dd_sincos_taylor(dd_make(lo, 0.0), &s_lo, &c_lo);
+      b /= dd_to_double(s_lo);
+    }
+    if (b > bound) bound = b;
+  }
+  return bound;
+}
+
+static void print_command(FILE *out, const struct fit *f, const char *name,
+                          const char *label) {
+  fprintf(out, "remez -d %d -m %.17g -M %.17g%s%s -n %s",
+          f->cosine ? 2 * f->terms : f->odd ? 2 * f->terms + 1 : f->terms - 1,
+          f->min_x, f->max_x, f->cosine ? " -c" : f->odd ? " -o" : "",
+          f->single ? " -f" : "", name);
+  if (label != NULL) fprintf(out, " -s -l %s", label);
+}
+
+static void print_header(FILE *out, const struct fit *f, const char *name) {
+  char guard[128];
+  int i;
+  for (i = 0; name[i] != '\0' && i < 120; i++) {
+    guard[i] = (name[i] >= 'a' && name[i] <= 'z') ? name[i] - 'a' + 'A' : name[i];
+  }
+  guard[i] = '\0';
+
+  fprintf(out, "// %s.h\n// Generated by: ", name);
+  print_command(out, f, name, NULL);
+  fprintf(out, "\n//\n");
+  if (f->cosine) {
+    fprintf(out, "// Cos(x) ~ 1 + x^2 * sum(%s[k] * x^(2k)) for %.17g <= x <= %.17g\n",
+            name, f->min_x, f->max_x);
+    fprintf(out, "// Minimax for the relative error.");
+  } else if (f->odd) {
+    fprintf(out, "// Sin(x) ~ x + x^3 * sum(%s[k] * x^(2k)) for %.17g <= x <= %.17g\n",
+            name, f->min_x, f->max_x);
+    fprintf(out, "// Minimax for the relative error.");
+  } else {
+    fprintf(out, "// Sin(x) ~ sum(%s[k] * x^k) for %.17g <= x <= %.17g\n",
+            name, f->min_x, f->max_x);
+    fprintf(out, "// Minimax for the absolute error.");
+  }
+  fprintf(out, "  Levelled error %.3e after %d exchanges;\n", f->level, f->iterations);
+  fprintf(out, "// with these rounded coefficients the error is at most %.3e,\n", f->bound);
+  fprintf(out, "// not counting rounding in the evaluation.\n\n");
+
+  fprintf(out, "#ifndef %s_H\n#define %s_H\n\n", guard, guard);
+  fprintf(out, "#define %s_TERMS %d\n", guard, f->terms);
+  fprintf(out, "#define %s_MIN_X %.17g\n", guard, f->min_x);
+  fprintf(out, "#define %s_MAX_X %.17g\n", guard, f->max_x);
+  fprintf(out, "#define %s_ERROR %.3e\n\n", guard, f->bound);
+  fprintf(out, "static const %s %s[%s_TERMS] = {\n",
+          f->single ? "float" : "double", name, guard);
+  for (int k = 0; k < f->terms; k++) {
+    if (f->single) {
+      fprintf(out, "  %+.9ef%s\n", f->coeff[k], k + 1 < f->terms ? "," : "");
+    } else {
+      fprintf(out, "  %+.23e%s\n", f->coeff[k], k + 1 < f->terms ? "," : "");
+    }
+  }
+  fprintf(out, "};\n\n#endif\n");
+}
+
+static void print_asm(FILE *out, const struct fit *f, const char *name, const char *label) {
+  fprintf(out, "// %s, generated by: ", name);
+  print_command(out, f, name, label);
+  fprintf(out, "\n// %s error <= %.3e\n", f->odd || f->cosine ? "relative" : "absolute",
+          f->bound);
+  for (int k = 0; k < f->terms; k++) {
+    if (f->single) {
+      fprintf(out, "%s%d:\t.float\t%+.9e\n", label, k, f->coeff[k]);
+    } else {
+      fprintf(out, "%s%d:\t.double\t%+.23e\n", label, k, f->coeff[k]);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  int degree = 13;
+  int odd = 0;
+  int cosine = 0;
+  int single = 0;
+  int assembler = 0;
+  double min_x = 0.0;
+  double max_x = M_PI_2;
+  const char *name = NULL;
+  const char *label = "a";
+  char default_name[64];
+
+  int c;
+  while ((c = getopt(argc, argv, "d:m:M:ocfn:sl:h")) != -1) {
+    switch (c) {
+    case 'd':
+      degree = atoi(optarg);
+      break;
+    case 'm':
+      min_x = atof(optarg);
+      break;
+    case 'M':
+      max_x = atof(optarg);
+      break;
+    case 'o':
+      odd = 1;
+      break;
+    case 'c':
+      cosine = 1;
+      break;
+    case 'f':
+      single = 1;
+      break;
+    case 'n':
+      name = optarg;
+      break;
+    case 's':
+      assembler = 1;
+      break;
+    case 'l':
+      label = optarg;
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(1);
+    }
+  }
+
+  struct fit f;
+  memset(&f, 0, sizeof(f));
+  f.odd = odd;
+  f.cosine = cosine;
+  f.single = single;
+  f.min_x = min_x;
+  f.max_x = max_x;
+  if (odd && cosine) {
+    fprintf(stderr, "Please choose one of -o and -c.\n");
+    exit(1);
+  }
+  if (cosine) {
+    if (degree < 2 || (degree & 1) != 0 || min_x < 0.0 || max_x >= M_PI_2) {
+      fprintf(stderr, "With -c the degree must be even and >= 2, and 0 <= min < max < Pi/2.\n");
+      exit(1);
+    }
+    f.terms = degree / 2;
+    f.min_t = min_x * min_x;
+    f.max_t = max_x * max_x;
+  } else if (odd) {
+    if (degree < 3 || (degree & 1) == 0 || min_x < 0.0) {
+      fprintf(stderr, "With -o the degree must be odd and >= 3, and min >= 0.\n");
+      exit(1);
+    }
+    f.terms = (degree - 1) / 2;
+    f.min_t = min_x * min_x;
+    f.max_t = max_x * max_x;
+  } else {
+    f.terms = degree + 1;
+    f.min_t = min_x;
+    f.max_t = max_x;
+  }
+  if (degree < 0 || f.terms > MAX_TERMS) {
+    fprintf(stderr, "Please specify a degree from 0 to %d.\n", MAX_TERMS - 1);
+    exit(1);
+  }
+  if (!(min_x < max_x) || fabs(max_x) > 2.0 || fabs(min_x) > 2.0) {
+    fprintf(stderr, "Please specify an interval inside [-2, 2].\n");
+    exit(1);
+  }
+  if (name == NULL) {
+    snprintf(default_name, sizeof(default_name),
+             cosine ? "cos_%d" : odd ? "sin_odd_%d" : "sin_%d", degree);
+    name = default_name;
+  }
+
+  if (remez(&f) != 0) {
+    fprintf(stderr, "The exchange failed: singular system.\n");
+    exit(1);
+  }
+  f.bound = error_bound(&f);
+  fprintf(stderr, "%s: levelled error %.3e after %d exchanges, bound %.3e\n",
+          name, f.level, f.iterations, f.bound);
+
+  if (assembler) {
+    print_asm(stdout, &f, name, label);
+  } else {
+    print_header(stdout, &f, name);
+  }
+  return 0;
+}
@@ -0,0 +1,208 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/utsname.h>
+#if defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+#include "mysin.h"
+#include "results.h"
+
+struct host_info {
+  char          hostname[256];
+  char          os[256];
+  char          machine[64];
+  char          cpu[256];
+  long          cpus;
+  char          date[32];       // UTC, ISO 8601
+};
+
+// The CPU's model name: /proc/cpuinfo on Linux, sysctl on macOS.
+static void cpu_name(char *buf, size_t len) {
+  snprintf(buf, len, "unknown");
+#if defined(__APPLE__)
+  size_t n = len;
+  if (sysctlbyname("machdep.cpu.brand_string", buf, &n, NULL, 0) != 0) {
+    snprintf(buf, len, "unknown");
+  }
+#elif defined(__linux__)
+  FILE *in = fopen("/proc/cpuinfo", "r");
+  if (in == NULL) return;
+  char line[512];
+  while (fgets(line, sizeof(line), in) != NULL) {
+    // "model name" on x86, "CPU part" is all arm64 gives
+    if (strncmp(line, "model name", 10) == 0 || strncmp(line, "CPU part", 8) == 0) {
+      char *v = strchr(line, ':');
+      if (v == NULL) continue;
+      v += strspn(v + 1, " \t") + 1;
+      v[strcspn(v, "\n")] = '\0';
+      snprintf(buf, len, "%s", v);
+      break;
+    }
+  }
+  fclose(in);
+#endif
+}
+
+static void get_host_info(struct host_info *h) {
+  struct utsname u;
+  memset(h, 0, sizeof(*h));
+  if (uname(&u) == 0) {
+    snprintf(h->hostname, sizeof(h->hostname), "%s", u.nodename);
+    snprintf(h->os, sizeof(h->os), "%s %s", u.sysname, u.release);
+    snprintf(h->machine, sizeof(h->machine), "%s", u.machine);
+  }
+  cpu_name(h->cpu, sizeof(h->cpu));
+  h->cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  time_t now = time(NULL);
+  strftime(h->date, sizeof(h->date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+}
+
+static void json_string(FILE *out, const char *s) {
+  fputc('"', out);
+  for (; *s != '\0'; s++) {
+    if (*s == '"' || *s == '\\') {
+      fprintf(out, "\\%c", *s);
+    } else if ((unsigned char)*s < 0x20) {
+      fprintf(out, "\\u%04x", *s);
+    } else {
+      fputc(*s, out);
+    }
+  }
+  fputc('"', out);
+}
+
+// %.17g round-trips a double; JSON has no NaN or Infinity.
+static void json_number(FILE *out, double v) {
+  if (v != v || v - v != 0.0) {
+    fprintf(out, "null");
+  } else {
+    fprintf(out, "%.17g", v);
+  }
+}
+
+static void json_timing(FILE *out, const struct timing *t) {
+  fprintf(out, "{\"ns\": ");
+  json_number(out, t->ns);
+  fprintf(out, ", \"ns_ci\": ");
+  json_number(out, t->ns_ci);
+  fprintf(out, ", \"cycles\": ");
+  json_number(out, t->cycles);
+  fprintf(out, ", \"cycles_ci\": ");
+  json_number(out, t->cycles_ci);
+  fprintf(out, ", \"reps\": %d}", t->reps);
+}
+
+void results_json(FILE *out, const struct bench_run *run, const struct benchCycle *stats) {
+  struct host_info h;
+  get_host_info(&h);
+  fprintf(out, "{\n  \"host\": {\"hostname\": ");
+  json_string(out, h.hostname);
+  fprintf(out, ", \"os\": ");
+  json_string(out, h.os);
+  fprintf(out, ", \"machine\": ");
+  json_string(out, h.machine);
+  fprintf(out, ", \"cpu\": ");
+  json_string(out, h.cpu);
+  fprintf(out, ", \"cpus\": %ld, \"kernels\": ", h.cpus);
+  json_string(out, sin_isa_name());
+  fprintf(out, ", \"timer\": ");
+  json_string(out, timer_name);
+  fprintf(out, ", \"ghz\": ");
+  json_number(out, timer_ghz);
+  fprintf(out, "},\n  \"run\": {\"date\": ");
+  json_string(out, h.date);
+  fprintf(out, ", \"function_A\": ");
+  json_string(out, run->f_A);
+  fprintf(out, ", \"function_B\": ");
+  json_string(out, run->f_B);
+  fprintf(out, ", \"batch\": %d, \"latency\": %d, \"sincos\": %d, \"cold_block\": %d",
+          run->batch, run->latency, run->sincos, run->cold_block);
+  fprintf(out, ", \"warmup\": %d, \"min_reps\": %d, \"max_reps\": %d, \"rel_ci\": ",
+          run->timing.warmup, run->timing.min_reps, run->timing.max_reps);
+  json_number(out, run->timing.rel_ci);
+  fprintf(out, ", \"order\": ");
+  json_string(out, run->order);
+  fprintf(out, ", \"distribution\": ");
+  json_string(out, run->distribution);
+  fprintf(out, ", \"min_x\": ");
+  json_number(out, run->min_x);
+  fprintf(out, ", \"max_x\": ");
+  json_number(out, run->max_x);
+  fprintf(out, ", \"seed\": %lu},\n  \"cycles\": [", run->seed);
+  for (int c = 0; c < run->cycles; c++) {
+    const struct benchCycle *s = &stats[c];
+    fprintf(out, "%s\n    {\"cycle\": %d, \"points\": %ld, \"min_x\": ", c ? "," : "", c, s->points);
+    json_number(out, s->minx);
+    fprintf(out, ", \"max_x\": ");
+    json_number(out, s->maxx);
+    fprintf(out, ", \"mean_ulp_A\": ");
+    json_number(out, s->mean_err);
+    fprintf(out, ", \"max_ulp_A\": ");
+    json_number(out, s->max_err);
+    fprintf(out, ", \"max_ulp_B\": ");
+    json_number(out, s->max_err_B);
+    fprintf(out, ",\n     \"A\": ");
+    json_timing(out, &s->time_A);
+    fprintf(out, ",\n     \"B\": ");
+    json_timing(out, &s->time_B);
+    fprintf(out, "}");
+  }
+  fprintf(out, "\n  ]\n}\n");
+}
+
+// Quoted, with quotes doubled, as RFC 4180 has it
+static void csv_string(FILE *out, const char *s) {
+  fputc('"', out);
+  for (; *s != '\0'; s++) {
+    if (*s == '"') fputc('"', out);
+    fputc(*s, out);
+  }
+  fputc('"', out);
+}
+
+void results_csv(FILE *out, const struct bench_run *run, const struct benchCycle *stats,
+                 int header) {
+  struct host_info h;
+  get_host_info(&h);
+  if (header) {
+    fprintf(out, "hostname,os,machine,cpu,cpus,kernels,timer,ghz,date,"
+            "function_A,function_B,batch,latency,sincos,cold_block,"
+            "warmup,min_reps,max_reps,rel_ci,order,distribution,"
+            "range_min,range_max,seed,"
+            "cycle,points,min_x,max_x,mean_ulp_A,max_ulp_A,max_ulp_B,"
+            "ns_A,ns_ci_A,cycles_A,cycles_ci_A,reps_A,"
+            "ns_B,ns_ci_B,cycles_B,cycles_ci_B,reps_B\n");
+  }
+  for (int c = 0; c < run->cycles; c++) {
+    const struct benchCycle *s = &stats[c];
+    csv_string(out, h.hostname);
+    fputc(',', out);
+    csv_string(out, h.os);
+    fputc(',', out);
+    csv_string(out, h.machine);
+    fputc(',', out);
+    csv_string(out, h.cpu);
+    fprintf(out, ",%ld,", h.cpus);
+    csv_string(out, sin_isa_name());
+    fputc(',', out);
+    csv_string(out, timer_name);
+    fprintf(out, ",%.17g,%s,", timer_ghz, h.date);
+    csv_string(out, run->f_A);
+    fputc(',', out);
+    csv_string(out, run->f_B);
+    fprintf(out, ",%d,%d,%d,%d,%d,%d,%d,%.17g,%s,", run->batch, run->latency, run->sincos,
+            run->cold_block, run->timing.warmup, run->timing.min_reps, run->timing.max_reps,
+            run->timing.rel_ci, run->order);
+    csv_string(out, run->distribution);
+    fprintf(out, ",%.17g,%.17g,%lu,", run->min_x, run->max_x, run->seed);
+    fprintf(out, "%d,%ld,%.17g,%.17g,%.17g,%.17g,%.17g,", c, s->points, s->minx, s->maxx,
+            s->mean_err, s->max_err, s->max_err_B);
+    fprintf(out, "%.17g,%.17g,%.17g,%.17g,%d,", s->time_A.ns, s->time_A.ns_ci,
+            s->time_A.cycles, s->time_A.cycles_ci, s->time_A.reps);
+    fprintf(out, "%.17g,%.17g,%.17g,%.17g,%d\n", s->time_B.ns, s->time_B.ns_ci,
+            s->time_B.cycles, s->time_B.cycles_ci, s->time_B.reps);
+  }
+}
@@ -0,0 +1,51 @@
+// results.h
+// benchmark's per-cycle results, and the JSON and CSV forms of them
+// (benchmark -F) with the host they were measured on, for compare and
+// for scripts.
+//
+// Both forms carry every field of struct benchCycle.  The CSV has one
+// row a cycle, with the run and host columns repeated on each, so that
+// files from several runs can be concatenated (less their headers).
+// JSON has one object a run, and benchmark one run a distribution.
+
+#ifndef RESULTS_H
+#define RESULTS_H
+
+#include <stdio.h>
+
+#include "timing.h"
+
+struct benchCycle {
+  long          points;
+  double        minx;
+  double        maxx;
+  double        mean_err;       // ulp errors of A
+  double        max_err;
+  double        max_err_B;
+  struct timing time_A;
+  struct timing time_B;
+};
+
+// What was run
+struct bench_run {
+  const char   *f_A;
+  const char   *f_B;
+  int           batch;          // A through its batch entry point
+  int           latency;        // dependent calls (-l)
+  int           sincos;         // sincos_3 against two calls of B (-S)
+  int           cold_block;     // calls between cache flushes (-C), 0 hot
+  struct timing_opts timing;    // warm-up and timed passes (-w, -r, -e)
+  const char   *order;          // of the points (-O)
+  const char   *distribution;   // they were drawn from (-D)
+  double        min_x;
+  double        max_x;
+  unsigned long seed;
+  int           cycles;
+};
+
+void results_json(FILE *out, const struct bench_run *run, const struct benchCycle *stats);
+// With header set, the column names first.
+void results_csv(FILE *out, const struct bench_run *run, const struct benchCycle *stats,
+                 int header);
+
+#endif
@@ -14,7 +14,6 @@
 
 _sin_3:
         mov     w1, wzr         // we're going to use w1 to keep some flags
-        fmov    d4, #2          // we're going to mulitply & divide by 2 later
 
         fcmp    d0, #0.0
         bge     pos             // x < 0, return -Sin(-x)
@@ -22,59 +21,88 @@ _sin_3:
         fneg    d0, d0
 
 pos:
-        LOADVAL d1, c2Pi        // d1 = 2*Pi
+        LOADVAL d1, cHuge       // |x| >= 2^20 goes to Payne-Hanek
         fcmp    d0, d1
-        ble     inrange
-        fdiv    d3, d0, d1      // d0 > 2*Pi
-        frintz  d3, d3          // floor
-        fmsub   d0, d3, d1, d0
+        bge     huge
 
-inrange:                        // d0 < 2*Pi
-        fdiv    d1, d1, d4      // d1 = Pi
-        fcmp    d0, d1
-        ble     first_half      // 0 <= x <= Pi
-        fsub    d0, d0, d1      // d0 = d0 - Pi
-        eor     w1, w1, 0x0001  // toggle 1st bit of w1, to negate the final answer
+        // Cody-Waite reduction, the same steps as cwReduce in angle_reduction.c:
+        // x = n*Pi/2 + r, n = round(x*2/Pi), r = d0 + d1.
+        LOADVAL d1, c2DPi
+        LOADVAL d2, cToInt
+        fmadd   d3, d0, d1, d2  // d3 = x*2/Pi + 1.5*2^52, n is in the low bits
+        fmov    x2, d3
+        fsub    d3, d3, d2      // d3 = n
+        LOADVAL d1, cPiD2_1
+        fmsub   d0, d3, d1, d0  // d0 = x - n*PiD2_1, exact
+        LOADVAL d1, cPiD2_2
+        fmul    d4, d3, d1      // d4 = p = n*PiD2_2
+        fnmsub  d5, d3, d1, d4  // d5 = n*PiD2_2 - p
+        fsub    d6, d0, d4      // d6 = hi = d0 - p
+        fsub    d7, d6, d0      // two-sum error of d0 - p:
+        fsub    d16, d6, d7     //   (d0 - (hi - bb)) - (p + bb)
+        fsub    d16, d0, d16
+        fadd    d17, d4, d7
+        fsub    d16, d16, d17
+        fsub    d16, d16, d5
+        LOADVAL d1, cPiD2_3
+        fmsub   d1, d3, d1, d16 // d1 = lo
+        fmov    d0, d6          // d0 = hi
+        mov     w0, w2
 
-first_half:
-        fdiv    d1, d1, d4      // d1 = Pi/2
-        fcmp    d0, d1
-        ble     approx          // 0 <= d0 <= Pi/2 - calculate the approximation
-        // Pi/2 < d0 <= Pi - return Sin(Pi-x)
-        fmul    d1, d1, d4      // d1 = Pi
-        fsub    d0, d1, d0      // d0 = Pi - d0
-
-approx:
-        LOADVAL d1, a0
-        LOADVAL d2, a1
-        LOADVAL d3, a2
-        LOADVAL d4, a3
-        LOADVAL d5, a4
-        LOADVAL d6, a5
-        LOADVAL d7, a6
-        LOADVAL d8, a7
-        LOADVAL d9, a8
-        LOADVAL d10, a9
-        LOADVAL d11, a10
-        LOADVAL d12, a11
-        LOADVAL d13, a12
-        LOADVAL d14, a13
-
-        fmadd   d13, d14, d0, d13
-        fmadd   d12, d13, d0, d12
-        fmadd   d11, d12, d0, d11
-        fmadd   d10, d11, d0, d10
-        fmadd   d9, d10, d0, d9
-        fmadd   d8, d9, d0, d8
-        fmadd   d7, d8, d0, d7
-        fmadd   d6, d7, d0, d6
-        fmadd   d5, d6, d0, d5
-        fmadd   d4, d5, d0, d4
-        fmadd   d3, d4, d0, d3
-        fmadd   d2, d3, d0, d2
-        fmadd   d1, d2, d0, d1
-
-        fmov    d0, d1
+quadrant:                       // w0 = quadrant, d0 + d1 = r, |r| <= Pi/4
+        tst     w0, #2          // quadrants 2 & 3 are negative
+        beq     parity
+        eor     w1, w1, 0x0001
+parity:
+        tst     w0, #1
+        bne     odd
+        fcmp    d0, #0.0        // even quadrant: Sin(r), approx takes |hi|
+        bge     approx
+        eor     w1, w1, 0x0001
+        fneg    d0, d0
+        b       approx
+odd:                            // odd quadrant: Cos(r) = Sin(Pi/2 - |r|)
+        fcmp    d0, #0.0
+        fneg    d2, d1
+        fcsel   d1, d2, d1, mi  // d1 = lo of |r|
+        fabs    d0, d0
+        LOADVAL d2, cPiD2_1
+        LOADVAL d3, cPiD2_2
+        fsub    d0, d2, d0
+        fsub    d3, d3, d1
+        fadd    d0, d0, d3
+
+approx:                         // 0 <= d0 <= Pi/2
+        LOADVAL d16, a0
+        LOADVAL d17, a1
+        LOADVAL d18, a2
+        LOADVAL d19, a3
+        LOADVAL d20, a4
+        LOADVAL d21, a5
+        LOADVAL d22, a6
+        LOADVAL d23, a7
+        LOADVAL d24, a8
+        LOADVAL d25, a9
+        LOADVAL d26, a10
+        LOADVAL d27, a11
+        LOADVAL d28, a12
+        LOADVAL d29, a13
+
+        fmadd   d28, d29, d0, d28
+        fmadd   d27, d28, d0, d27
+        fmadd   d26, d27, d0, d26
+        fmadd   d25, d26, d0, d25
+        fmadd   d24, d25, d0, d24
+        fmadd   d23, d24, d0, d23
+        fmadd   d22, d23, d0, d22
+        fmadd   d21, d22, d0, d21
+        fmadd   d20, d21, d0, d20
+        fmadd   d19, d20, d0, d19
+        fmadd   d18, d19, d0, d18
+        fmadd   d17, d18, d0, d17
+        fmadd   d16, d17, d0, d16
+
+        fmov    d0, d16
         and     w1, w1, 0x0001
         cmp     w1, #0
         beq     end
@@ -83,6 +111,18 @@ approx:
 end:
         ret
 
+huge:                           // d0 = |x| >= 2^20, w1 = sign flag
+        stp     x29, x30, [sp, #-48]!
+        mov     x29, sp
+        str     w1, [sp, #32]   // keep the flag across the call
+        add     x0, sp, #16     // &hi
+        add     x1, sp, #24     // &lo
+        bl      _phReduce       // w0 = quadrant, |x| = w0*Pi/2 + hi + lo
+        ldr     w1, [sp, #32]
+        ldp     d0, d1, [sp, #16]
+        ldp     x29, x30, [sp], #48
+        b       quadrant
+
 .p2align        2
 .data
 a0:	.double	+3.15159609307366933583264e-17
@@ -100,7 +140,12 @@ a11:	.double	-2.60546344930653900663444e-8
 a12:	.double	+3.11243537080303902068867e-10
 a13:	.double	+1.12392760716968552199773e-10
 
-c2Pi:   .double +6.28318530717958647692529
+c2DPi:  .double +6.36619772367581382433e-01     // 2/Pi
+cToInt: .double +6755399441055744.0             // 1.5*2^52
+cPiD2_1: .double +1.57079632679489655800e+00    // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+cPiD2_2: .double +6.12323399573676603587e-17
+cPiD2_3: .double -1.49738490485916983294e-33
+cHuge:  .double +1048576.0
 
         /*
 Questions:
@@ -0,0 +1,147 @@
+// sin3b.s
+// sin3.s without branches on the common path
+//
+// sin3.s branches on the sign of x, the quadrant, its parity, and the
+// sign of r; on random arguments each of those goes either way half
+// the time and the mispredictions cost more than the polynomial.  Here
+// the sign of the result is built up in w10 with integer operations,
+// Pi/2 - |r| is computed every time and picked with fcsel, and the
+// result is negated by flipping its sign bit.  The one branch left
+// catches |x| < 2^-26 (Sin(x) = x), |x| >= 2^20 (Payne-Hanek), Inf and
+// NaN together, with a single unsigned compare on the bits of |x|.
+//
+// The constants sit in one table, tab3b, whose address is loaded once;
+// they come in pairs with ldp.  The results are bit for bit those of
+// sin3.s, except for |x| < 2^-26, where sin3.s returns P(|x|) and not x.
+
+.global         _sin_3b
+.p2align        2		// Make sure everything is aligned properly
+
+.text
+
+_sin_3b:
+        adrp    x9, tab3b@GOTPAGE
+        ldr     x9, [x9, tab3b@GOTPAGEOFF]
+        fmov    x1, d0
+        lsr     x10, x1, #63            // w10 = 1 to negate the result, starting with x < 0
+        and     x2, x1, #0x7fffffffffffffff
+        mov     x3, #0x3e50000000000000 // 2^-26
+        mov     x4, #0x02e0000000000000 // 2^20 - 2^-26, as bits
+        sub     x5, x2, x3
+        cmp     x5, x4
+        b.hs    rare                    // tiny, huge, Inf or NaN
+        fabs    d0, d0
+
+        // Cody-Waite reduction, the same steps as cwReduce in angle_reduction.c:
+        // |x| = n*Pi/2 + r, n = round(|x|*2/Pi), r = d0 + d1.
+        ldp     d1, d2, [x9]            // 2/Pi, 1.5*2^52
+        fmadd   d3, d0, d1, d2          // d3 = |x|*2/Pi + 1.5*2^52, n is in the low bits
+        fmov    x11, d3
+        fsub    d3, d3, d2              // d3 = n
+        ldp     d1, d2, [x9, #16]       // PiD2_1, PiD2_2
+        fmsub   d0, d3, d1, d0          // d0 = |x| - n*PiD2_1, exact
+        fmul    d4, d3, d2              // d4 = p = n*PiD2_2
+        fnmsub  d5, d3, d2, d4          // d5 = n*PiD2_2 - p
+        fsub    d6, d0, d4              // d6 = hi = d0 - p
+        fsub    d7, d6, d0              // two-sum error of d0 - p:
+        fsub    d16, d6, d7             //   (d0 - (hi - bb)) - (p + bb)
+        fsub    d16, d0, d16
+        fadd    d17, d4, d7
+        fsub    d16, d16, d17
+        fsub    d16, d16, d5
+        ldr     d1, [x9, #32]           // PiD2_3
+        fmsub   d1, d3, d1, d16         // d1 = lo
+        fmov    d0, d6                  // d0 = hi
+
+reduced:                                // w11 = quadrant, d0 + d1 = r, |r| <= Pi/4
+        ubfx    w12, w11, #1, #1        // quadrants 2 & 3 are negative
+        eor     w10, w10, w12
+        fcmp    d0, #0.0
+        cset    w12, mi                 // w12 = r < 0
+        bic     w12, w12, w11           //   which negates Sin(r) in even quadrants only
+        eor     w10, w10, w12
+        fneg    d2, d1
+        fcsel   d1, d2, d1, mi          // d1 = lo of |r|
+        fabs    d0, d0
+        ldp     d2, d3, [x9, #16]       // odd quadrant: Cos(r) = Sin(Pi/2 - |r|)
+        fsub    d2, d2, d0
+        fsub    d3, d3, d1
+        fadd    d2, d2, d3
+        tst     w11, #1
+        fcsel   d0, d2, d0, ne          // 0 <= d0 <= Pi/2
+
+        ldp     d28, d29, [x9, #144]    // a12, a13
+        ldp     d26, d27, [x9, #128]
+        ldp     d24, d25, [x9, #112]
+        ldp     d22, d23, [x9, #96]
+        ldp     d20, d21, [x9, #80]
+        ldp     d18, d19, [x9, #64]
+        ldp     d16, d17, [x9, #48]     // a0, a1
+
+        fmadd   d28, d29, d0, d28
+        fmadd   d27, d28, d0, d27
+        fmadd   d26, d27, d0, d26
+        fmadd   d25, d26, d0, d25
+        fmadd   d24, d25, d0, d24
+        fmadd   d23, d24, d0, d23
+        fmadd   d22, d23, d0, d22
+        fmadd   d21, d22, d0, d21
+        fmadd   d20, d21, d0, d20
+        fmadd   d19, d20, d0, d19
+        fmadd   d18, d19, d0, d18
+        fmadd   d17, d18, d0, d17
+        fmadd   d16, d17, d0, d16
+
+        fmov    x1, d16                 // flip the sign bit if w10 says so
+        eor     x1, x1, x10, lsl #63
+        fmov    d0, x1
+        ret
+
+rare:                                   // x1 = x, x2 = |x| as bits, x3 = 2^-26
+        cmp     x2, x3
+        b.lo    done                    // |x| < 2^-26: Sin(x) = x
+        mov     x5, #0x7ff0000000000000
+        cmp     x2, x5
+        b.hs    nonfinite
+        stp     x29, x30, [sp, #-48]!   // 2^20 <= |x|: Payne-Hanek
+        mov     x29, sp
+        str     x10, [sp, #32]          // keep the sign across the call
+        fabs    d0, d0
+        add     x0, sp, #16             // &hi
+        add     x1, sp, #24             // &lo
+        bl      _phReduce               // w0 = quadrant, |x| = w0*Pi/2 + hi + lo
+        and     w11, w0, #3
+        ldr     x10, [sp, #32]
+        ldp     d0, d1, [sp, #16]
+        ldp     x29, x30, [sp], #48
+        adrp    x9, tab3b@GOTPAGE
+        ldr     x9, [x9, tab3b@GOTPAGEOFF]
+        b       reduced
+nonfinite:                              // Inf or NaN: NaN
+        fsub    d0, d0, d0
+done:
+        ret
+
+.p2align        3
+.data
+tab3b:
+        .double +6.36619772367581382433e-01     // 2/Pi
+        .double +6755399441055744.0             // 1.5*2^52
+        .double +1.57079632679489655800e+00     // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+        .double +6.12323399573676603587e-17
+        .double -1.49738490485916983294e-33
+        .double 0.0
+        .double +3.15159609307366933583264e-17  // a0 ... a13, as in sin3.s
+        .double +9.99999999999992137463981e-1
+        .double +3.24848403977218879514298e-13
+        .double -1.66666666671945646405887e-1
+        .double +4.46929940061919965152147e-11
+        .double +8.33333310712103651500584e-3
+        .double +7.39903364746182917886826e-10
+        .double -1.98414335571346275936300e-4
+        .double +2.51241790401253696723421e-9
+        .double +2.75303544969185019022074e-6
+        .double +2.00650971121911487700779e-9
+        .double -2.60546344930653900663444e-8
+        .double +3.11243537080303902068867e-10
+        .double +1.12392760716968552199773e-10
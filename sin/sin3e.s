@@ -0,0 +1,159 @@
+// sin3e.s
+// sin3.s with the polynomial evaluated by Estrin's scheme
+//
+// Horner's rule is a chain of 13 dependent fmadds.  Here the terms are
+// paired, a[2k] + a[2k+1]*x, then the pairs combined with x^2, those
+// with x^4, and the last two halves with x^8.  That is 16 instructions
+// instead of 13, but the longest dependent chain is 4 deep, so a call
+// whose result is needed right away finishes much sooner on a core
+// that can issue several fmadds at once.  The rounding differs from
+// sin3.s: about half of the results move by an ulp or two.
+
+.global         _sin_3e
+.p2align        2		// Make sure everything is aligned properly
+
+        .macro  LOADVAL reg, name
+        adrp    x0, \name@GOTPAGE
+        ldr     x0, [x0, \name@GOTPAGEOFF]
+        ldr     \reg, [x0]
+        .endm
+
+.text
+
+_sin_3e:
+        mov     w1, wzr         // we're going to use w1 to keep some flags
+
+        fcmp    d0, #0.0
+        bge     pos             // x < 0, return -Sin(-x)
+        mov     w1, 0x0001      // 1 in w1 bit 1 will mean negate the result at the end
+        fneg    d0, d0
+
+pos:
+        LOADVAL d1, cHuge       // |x| >= 2^20 goes to Payne-Hanek
+        fcmp    d0, d1
+        bge     huge
+
+        // Cody-Waite reduction, the same steps as cwReduce in angle_reduction.c:
+        // x = n*Pi/2 + r, n = round(x*2/Pi), r = d0 + d1.
+        LOADVAL d1, c2DPi
+        LOADVAL d2, cToInt
+        fmadd   d3, d0, d1, d2  // d3 = x*2/Pi + 1.5*2^52, n is in the low bits
+        fmov    x2, d3
+        fsub    d3, d3, d2      // d3 = n
+        LOADVAL d1, cPiD2_1
+        fmsub   d0, d3, d1, d0  // d0 = x - n*PiD2_1, exact
+        LOADVAL d1, cPiD2_2
+        fmul    d4, d3, d1      // d4 = p = n*PiD2_2
+        fnmsub  d5, d3, d1, d4  // d5 = n*PiD2_2 - p
+        fsub    d6, d0, d4      // d6 = hi = d0 - p
+        fsub    d7, d6, d0      // two-sum error of d0 - p:
+        fsub    d16, d6, d7     //   (d0 - (hi - bb)) - (p + bb)
+        fsub    d16, d0, d16
+        fadd    d17, d4, d7
+        fsub    d16, d16, d17
+        fsub    d16, d16, d5
+        LOADVAL d1, cPiD2_3
+        fmsub   d1, d3, d1, d16 // d1 = lo
+        fmov    d0, d6          // d0 = hi
+        mov     w0, w2
+
+quadrant:                       // w0 = quadrant, d0 + d1 = r, |r| <= Pi/4
+        tst     w0, #2          // quadrants 2 & 3 are negative
+        beq     parity
+        eor     w1, w1, 0x0001
+parity:
+        tst     w0, #1
+        bne     odd
+        fcmp    d0, #0.0        // even quadrant: Sin(r), approx takes |hi|
+        bge     approx
+        eor     w1, w1, 0x0001
+        fneg    d0, d0
+        b       approx
+odd:                            // odd quadrant: Cos(r) = Sin(Pi/2 - |r|)
+        fcmp    d0, #0.0
+        fneg    d2, d1
+        fcsel   d1, d2, d1, mi  // d1 = lo of |r|
+        fabs    d0, d0
+        LOADVAL d2, cPiD2_1
+        LOADVAL d3, cPiD2_2
+        fsub    d0, d2, d0
+        fsub    d3, d3, d1
+        fadd    d0, d0, d3
+
+approx:                         // 0 <= d0 <= Pi/2
+        LOADVAL d16, a0
+        LOADVAL d17, a1
+        LOADVAL d18, a2
+        LOADVAL d19, a3
+        LOADVAL d20, a4
+        LOADVAL d21, a5
+        LOADVAL d22, a6
+        LOADVAL d23, a7
+        LOADVAL d24, a8
+        LOADVAL d25, a9
+        LOADVAL d26, a10
+        LOADVAL d27, a11
+        LOADVAL d28, a12
+        LOADVAL d29, a13
+
+        fmul    d2, d0, d0      // d2 = x^2
+        fmadd   d16, d17, d0, d16       // a0 + a1*x
+        fmadd   d18, d19, d0, d18       // a2 + a3*x
+        fmadd   d20, d21, d0, d20       // ...
+        fmadd   d22, d23, d0, d22
+        fmadd   d24, d25, d0, d24
+        fmadd   d26, d27, d0, d26
+        fmadd   d28, d29, d0, d28       // a12 + a13*x
+        fmul    d3, d2, d2      // d3 = x^4
+        fmadd   d16, d18, d2, d16       // a0..a3
+        fmadd   d20, d22, d2, d20       // a4..a7
+        fmadd   d24, d26, d2, d24       // a8..a11
+        fmul    d4, d3, d3      // d4 = x^8
+        fmadd   d16, d20, d3, d16       // a0..a7
+        fmadd   d24, d28, d3, d24       // a8..a13
+        fmadd   d16, d24, d4, d16       // a0..a13
+
+        fmov    d0, d16
+        and     w1, w1, 0x0001
+        cmp     w1, #0
+        beq     end
+        fneg    d0, d0
+
+end:
+        ret
+
+huge:                           // d0 = |x| >= 2^20, w1 = sign flag
+        stp     x29, x30, [sp, #-48]!
+        mov     x29, sp
+        str     w1, [sp, #32]   // keep the flag across the call
+        add     x0, sp, #16     // &hi
+        add     x1, sp, #24     // &lo
+        bl      _phReduce       // w0 = quadrant, |x| = w0*Pi/2 + hi + lo
+        ldr     w1, [sp, #32]
+        ldp     d0, d1, [sp, #16]
+        ldp     x29, x30, [sp], #48
+        b       quadrant
+
+.p2align        2
+.data
+a0:	.double	+3.15159609307366933583264e-17
+a1:	.double	+9.99999999999992137463981e-1
+a2:	.double	+3.24848403977218879514298e-13
+a3:	.double	-1.66666666671945646405887e-1
+a4:	.double	+4.46929940061919965152147e-11
+a5:	.double	+8.33333310712103651500584e-3
+a6:	.double	+7.39903364746182917886826e-10
+a7:	.double	-1.98414335571346275936300e-4
+a8:	.double	+2.51241790401253696723421e-9
+a9:	.double	+2.75303544969185019022074e-6
+a10:	.double	+2.00650971121911487700779e-9
+a11:	.double	-2.60546344930653900663444e-8
+a12:	.double	+3.11243537080303902068867e-10
+a13:	.double	+1.12392760716968552199773e-10
+
+c2DPi:  .double +6.36619772367581382433e-01     // 2/Pi
+cToInt: .double +6755399441055744.0             // 1.5*2^52
+cPiD2_1: .double +1.57079632679489655800e+00    // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+cPiD2_2: .double +6.12323399573676603587e-17
+cPiD2_3: .double -1.49738490485916983294e-33
+cHuge:  .double +1048576.0
@@ -0,0 +1,143 @@
+// sin4.s
+// Approximate Sin(x) by an odd minimax polynomial, x + x^3*P(x^2)
+//
+// The reduction is the one in sin3.s.  The even coefficients of the
+// sin3.s polynomial are all but zero, so this one leaves them out:
+// 7 coefficients instead of 14, 7 fmadds and 2 fmuls instead of 13
+// fmadds.  Being odd it is exactly antisymmetric, and Sin(+-0) = +-0.
+// In even quadrants the lo word of the reduced argument is added to x
+// before x^3*P(x^2), since near a multiple of Pi/2 hi can be as small
+// as lo.
+// Relative error <= 1.9e-16 on [0, Pi/2] before rounding.
+
+.global         _sin_4
+.p2align        2		// Make sure everything is aligned properly
+
+        .macro  LOADVAL reg, name
+        adrp    x0, \name@GOTPAGE
+        ldr     x0, [x0, \name@GOTPAGEOFF]
+        ldr     \reg, [x0]
+        .endm
+
+.text
+
+_sin_4:
+        mov     w1, wzr         // we're going to use w1 to keep some flags
+
+        fmov    x3, d0
+        tbz     x3, #63, pos    // sign bit set (x < 0 or -0), return -Sin(-x)
+        mov     w1, 0x0001      // 1 in w1 bit 1 will mean negate the result at the end
+        fneg    d0, d0
+
+pos:
+        LOADVAL d1, cHuge       // |x| >= 2^20 goes to Payne-Hanek
+        fcmp    d0, d1
+        bge     huge
+
+        // Cody-Waite reduction, the same steps as cwReduce in angle_reduction.c:
+        // x = n*Pi/2 + r, n = round(x*2/Pi), r = d0 + d1.
+        LOADVAL d1, c2DPi
+        LOADVAL d2, cToInt
+        fmadd   d3, d0, d1, d2  // d3 = x*2/Pi + 1.5*2^52, n is in the low bits
+        fmov    x2, d3
+        fsub    d3, d3, d2      // d3 = n
+        LOADVAL d1, cPiD2_1
+        fmsub   d0, d3, d1, d0  // d0 = x - n*PiD2_1, exact
+        LOADVAL d1, cPiD2_2
+        fmul    d4, d3, d1      // d4 = p = n*PiD2_2
+        fnmsub  d5, d3, d1, d4  // d5 = n*PiD2_2 - p
+        fsub    d6, d0, d4      // d6 = hi = d0 - p
+        fsub    d7, d6, d0      // two-sum error of d0 - p:
+        fsub    d16, d6, d7     //   (d0 - (hi - bb)) - (p + bb)
+        fsub    d16, d0, d16
+        fadd    d17, d4, d7
+        fsub    d16, d16, d17
+        fsub    d16, d16, d5
+        LOADVAL d1, cPiD2_3
+        fmsub   d1, d3, d1, d16 // d1 = lo
+        fmov    d0, d6          // d0 = hi
+        mov     w0, w2
+
+quadrant:                       // w0 = quadrant, d0 + d1 = r, |r| <= Pi/4
+        tst     w0, #2          // quadrants 2 & 3 are negative
+        beq     parity
+        eor     w1, w1, 0x0001
+parity:
+        tst     w0, #1
+        bne     odd
+        fcmp    d0, #0.0        // even quadrant: Sin(r), approx takes |hi| and
+        bge     approx          //   the lo word with the same sign
+        eor     w1, w1, 0x0001
+        fneg    d0, d0
+        fneg    d1, d1
+        b       approx
+odd:                            // odd quadrant: Cos(r) = Sin(Pi/2 - |r|)
+        fcmp    d0, #0.0
+        fneg    d2, d1
+        fcsel   d1, d2, d1, mi  // d1 = lo of |r|
+        fabs    d0, d0
+        LOADVAL d2, cPiD2_1
+        LOADVAL d3, cPiD2_2
+        fsub    d0, d2, d0
+        fsub    d3, d3, d1
+        fadd    d0, d0, d3
+        fmov    d1, xzr         // lo is folded in
+
+approx:                         // 0 <= d0 <= Pi/2, d1 = lo
+        LOADVAL d16, c0
+        LOADVAL d17, c1
+        LOADVAL d18, c2
+        LOADVAL d19, c3
+        LOADVAL d20, c4
+        LOADVAL d21, c5
+        LOADVAL d22, c6
+
+        fmul    d2, d0, d0      // d2 = x^2
+        fmul    d3, d2, d0      // d3 = x^3
+        fmadd   d21, d22, d2, d21
+        fmadd   d20, d21, d2, d20
+        fmadd   d19, d20, d2, d19
+        fmadd   d18, d19, d2, d18
+        fmadd   d17, d18, d2, d17
+        fmadd   d16, d17, d2, d16       // d16 = P(x^2)
+        fadd    d1, d0, d1              // d1 = x + lo
+        fmadd   d0, d16, d3, d1         // d0 = x + lo + x^3*P(x^2)
+
+        and     w1, w1, 0x0001
+        cmp     w1, #0
+        beq     end
+        fneg    d0, d0
+
+end:
+        ret
+
+huge:                           // d0 = |x| >= 2^20, w1 = sign flag
+        stp     x29, x30, [sp, #-48]!
+        mov     x29, sp
+        str     w1, [sp, #32]   // keep the flag across the call
+        add     x0, sp, #16     // &hi
+        add     x1, sp, #24     // &lo
+        bl      _phReduce       // w0 = quadrant, |x| = w0*Pi/2 + hi + lo
+        ldr     w1, [sp, #32]
+        ldp     d0, d1, [sp, #16]
+        ldp     x29, x30, [sp], #48
+        b       quadrant
+
+.p2align        2
+.data
+// sin_4, generated by: remez -d 15 -m 0 -M 1.5707963267948966 -o -n sin_4 -s -l c
+// relative error <= 1.845e-16
+c0:	.double	-1.66666666666661855700227e-01
+c1:	.double	+8.33333333328554158592194e-03
+c2:	.double	-1.98412698250562591264362e-04
+c3:	.double	+2.75573166005527716508183e-06
+c4:	.double	-2.50518802738688894710702e-08
+c5:	.double	+1.60480954050756855128200e-10
+c6:	.double	-7.37334453387496351913116e-13
+
+c2DPi:  .double +6.36619772367581382433e-01     // 2/Pi
+cToInt: .double +6755399441055744.0             // 1.5*2^52
+cPiD2_1: .double +1.57079632679489655800e+00    // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+cPiD2_2: .double +6.12323399573676603587e-17
+cPiD2_3: .double -1.49738490485916983294e-33
+cHuge:  .double +1048576.0
@@ -0,0 +1,114 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "variant.h"
+#include "mysin.h"
+#include "sintab.h"
+
+// Table-driven Sin(x), after do_sin and do_cos in glibc (refs/s_sin.c).
+//
+// The Cody-Waite reduction of sin_3 leaves x = n*Pi/2 + r with
+// |r| <= Pi/4.  |r| is split once more into the nearest table node and
+// what is left over, |r| = k*h + d with h = Pi/(4N) and |d| <= h/2, and
+//
+//     Sin(k*h + d) = Sin(k*h)*Cos(d) + Cos(k*h)*Sin(d)
+//     Cos(k*h + d) = Cos(k*h)*Cos(d) - Sin(k*h)*Sin(d)
+//
+// Sin(k*h) and Cos(k*h) come from the table (sintab.h, written by
+// sintab) as hi + lo pairs, and Sin(d) and 1 - Cos(d) are Taylor
+// polynomials of degree 5 and 6: for N >= 64, |d| <= Pi/512 and the
+// first term left out is below 2^-60.  The longest dependency chain is
+// the 4 deep polynomial in d^2, against 13 for sin_3.
+//
+// h is Pi/2 divided by a power of two, so the Cody-Waite constants
+// just scale: k comes from the same 1.5*2^52 rounding trick and
+// |r| - k*PiD2_1/(2N) is exact.  Each node is 32 bytes and the tables
+// are 64 byte aligned, so a call touches one cache line out of
+// 2 KB (N = 64), 4 KB (128) or 8 KB (256).
+
+static const double c2DPi = 6.36619772367581382433e-01;
+static const double cToInt = 6755399441055744.0;
+static const double cPiD2_1 = 1.57079632679489655800e+00;
+static const double cPiD2_2 = 6.12323399573676603587e-17;
+static const double cPiD2_3 = -1.49738490485916983294e-33;
+static const double cHuge = 1048576.0;
+
+// Sin(d) = d + d^3*(S3 + d^2*S5), 1 - Cos(d) = d^2*(C2 + d^2*(C4 + d^2*C6))
+static const double S3 = -1.66666666666666666667e-01;
+static const double S5 = 8.33333333333333333333e-03;
+static const double C2 = 5.00000000000000000000e-01;
+static const double C4 = -4.16666666666666666667e-02;
+static const double C6 = 1.38888888888888888889e-03;
+
+static inline double sin_5_kernel(double x, const struct sintab_entry *tab,
+                                  const int nodes) {
+  double hi, lo;
+  int n;
+
+  if (fabs(x) < cHuge) {
+    // Cody-Waite, as cwReduce in angle_reduction.c
+    double t = fma(x, c2DPi, cToInt);
+    uint64_t bits;
+    memcpy(&bits, &t, sizeof(bits));
+    double m = t - cToInt;
+    double r = fma(-m, cPiD2_1, x);
+    double p = m * cPiD2_2;
+    double pe = fma(m, cPiD2_2, -p);
+    hi = r - p;
+    double bb = hi - r;
+    double e = (r - (hi - bb)) - (p + bb);
+    lo = fma(-m, cPiD2_3, e - pe);
+    n = bits & 3;
+  } else {
+    if (!isfinite(x)) return x - x;
+    n = phReduce(x, &hi, &lo);
+  }
+
+  // Quadrants 2 and 3 are negative, and so is Sin(r) for r < 0.
+  int negate = n >> 1;
+  if (signbit(hi)) {
+    hi = -hi;
+    lo = -lo;
+    negate ^= ~n & 1;
+  }
+
+  // |r| = k*h + d + dx
+  double t = fma(hi, c2DPi * (2 * nodes), cToInt);
+  double k = t - cToInt;
+  double d = fma(-k, cPiD2_1 / (2 * nodes), hi);
+  double dx = fma(-k, cPiD2_2 / (2 * nodes), lo);
+  const struct sintab_entry *e = &tab[(int)k];
+
+  double dd = d * d;
+  double st = dx + d * dd * (S3 + dd * S5);
+  double s = d + st;                                   // Sin(d + dx)
+  double c = d * dx + dd * (C2 + dd * (C4 + dd * C6)); // 1 - Cos(d + dx)
+
+  // Near the first few nodes Sin(k*h) and Cos(k*h)*d come close to
+  // cancelling, so that sum is kept exact and only the small terms are
+  // rounded.
+  double y;
+  if (n & 1) {
+    y = e->cs + (((e->ccs - s * e->ssn) - e->cs * c) - e->sn * s);
+  } else {
+    double p = e->cs * d;
+    double pe = fma(e->cs, d, -p);
+    double h = e->sn + p;
+    double he = (e->sn - h) + p;
+    y = h + (((((e->ssn + he) + pe) + e->cs * st) + s * e->ccs) - e->sn * c);
+  }
+  return negate ? -y : y;
+}
+
+double sin_5(double x) {
+  return sin_5_kernel(x, sintab_128, 128);
+}
+
+double sin_5_64(double x) {
+  return sin_5_kernel(x, sintab_64, 64);
+}
+
+double sin_5_256(double x) {
+  return sin_5_kernel(x, sintab_256, 256);
+}
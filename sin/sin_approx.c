@@ -0,0 +1,14 @@
+#include "variant.h"
+#include "sin_approx.h"
+
+// One external instance of each sin_approx.h kernel, for benchmark.
+
+SIN_APPROX(sin_approx_pi2_7, 7, PI2)
+SIN_APPROX(sin_approx_pi2_9, 9, PI2)
+SIN_APPROX(sin_approx_pi2_11, 11, PI2)
+SIN_APPROX(sin_approx_pi2_13, 13, PI2)
+SIN_APPROX(sin_approx_pi2_15, 15, PI2)
+SIN_APPROX(sin_approx_pi4_7, 7, PI4)
+SIN_APPROX(sin_approx_pi4_9, 9, PI4)
+SIN_APPROX(sin_approx_pi4_11, 11, PI4)
+SIN_APPROX(sin_approx_pi4_13, 13, PI4)
@@ -0,0 +1,302 @@
+// sin_approx.h
+// Sin(x) to a chosen accuracy, specialized at compile time.
+//
+//     SIN_APPROX(name, degree, interval)
+//
+// defines double name(double x), with the same reduction as sin_5 and
+// a minimax polynomial picked by degree and interval:
+//
+//     PI2     one odd polynomial x + x^3*P(x^2) on [0, Pi/2], folded as in
+//             sin_4: P(|r|) in even quadrants, P(Pi/2 - |r|) in odd ones.
+//             degree 7, 9, 11, 13 or 15.
+//     PI4     Sin(r) ~ r + r^3*S(r^2) in even quadrants and
+//             Cos(r) ~ 1 + r^2*C(r^2) in odd ones, both on [0, Pi/4].
+//             degree 7, 9, 11 or 13 is that of Sin, Cos has one more.
+//
+// Any other pair is a compile error.  SIN_APPROX_ERROR(degree, interval)
+// is the relative error bound of the polynomial; rounding in the
+// evaluation comes on top, about 1 ulp.  Measured against sinl:
+//
+//     degree        7        9        11       13       15
+//     PI2       1.1e-06  6.1e-09  2.4e-11  6.9e-14  3.2 ulp
+//     PI4       3.8e-09  5.2e-12  5.1e-15  0.87 ulp
+//
+// Everything is static, so the coefficients are constants of the
+// caller and the fixed-length Horner loops unroll: no table walks, no
+// loads through the GOT, and no calls but to phReduce for huge x as
+// long as fma() is an instruction, as on arm64 or with -mfma (the
+// _fma build on x86-64, variant.h).  Without it each fma() is a call
+// into libm.  Instantiate it as
+//
+//     static inline SIN_APPROX(my_sin, 9, PI4)
+//
+// or without static inline to get an external function; sin_approx.c
+// exports one of each for the benchmark.
+
+#ifndef SIN_APPROX_H
+#define SIN_APPROX_H
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#include "mysin.h"
+
+#define SIN_APPROX(name, degree, interval) SA_DEFINE_##interval(name, degree)
+#define SIN_APPROX_ERROR(degree, interval) SA_##interval##_##degree##_ERROR
+
+#define SA_DEFINE_PI2(name, degree) \
+  double name(double x) { \
+    return sa_kernel_pi2(x, sa_pi2_##degree, SA_PI2_##degree##_TERMS); \
+  }
+#define SA_DEFINE_PI4(name, degree) \
+  double name(double x) { \
+    return sa_kernel_pi4(x, sa_pi4_sin_##degree, SA_PI4_SIN_##degree##_TERMS, \
+                         sa_pi4_cos_##degree, SA_PI4_COS_##degree##_TERMS); \
+  }
+
+// remez -d 7 -m 0 -M 1.5707963267948966 -o -n sa_pi2_7
+#define SA_PI2_7_TERMS 3
+#define SA_PI2_7_ERROR 1.108e-06
+static const double sa_pi2_7[SA_PI2_7_TERMS] = {
+  -1.66658532529914887865274e-01,
+  +8.31427474557066593929822e-03,
+  -1.85422229074532564406866e-04
+};
+
+// remez -d 9 -m 0 -M 1.5707963267948966 -o -n sa_pi2_9
+#define SA_PI2_9_TERMS 4
+#define SA_PI2_9_ERROR 6.054e-09
+static const double sa_pi2_9[SA_PI2_9_TERMS] = {
+  -1.66666595504277564865347e-01,
+  +8.33306624608216341132394e-03,
+  -1.98096029019383367822046e-04,
+  +2.60578063796857461691787e-06
+};
+
+// remez -d 11 -m 0 -M 1.5707963267948966 -o -n sa_pi2_11
+#define SA_PI2_11_TERMS 5
+#define SA_PI2_11_ERROR 2.355e-11
+static const double sa_pi2_11[SA_PI2_11_TERMS] = {
+  -1.66666666261494955669775e-01,
+  +8.33333110859674382198126e-03,
+  -1.98408682090602683399314e-04,
+  +2.75253843815859781501412e-06,
+  -2.38889085215007388892558e-08
+};
+
+// remez -d 13 -m 0 -M 1.5707963267948966 -o -n sa_pi2_13
+#define SA_PI2_13_TERMS 6
+#define SA_PI2_13_ERROR 6.843e-14
+static const double sa_pi2_13[SA_PI2_13_TERMS] = {
+  -1.66666666665046064865763e-01,
+  +8.33333332108732519061256e-03,
+  -1.98412667297273072070790e-04,
+  +2.75569531121510546969812e-06,
+  -2.50301969000302199159181e-08,
+  +1.54095280277533162940002e-10
+};
+
+// remez -d 15 -m 0 -M 1.5707963267948966 -o -n sa_pi2_15
+#define SA_PI2_15_TERMS 7
+#define SA_PI2_15_ERROR 1.845e-16
+static const double sa_pi2_15[SA_PI2_15_TERMS] = {
+  -1.66666666666661855700227e-01,
+  +8.33333333328554158592194e-03,
+  -1.98412698250562591264362e-04,
+  +2.75573166005527716508183e-06,
+  -2.50518802738688894710702e-08,
+  +1.60480954050756855128200e-10,
+  -7.37334453387496351913116e-13
+};
+
+// remez -d 7 -m 0 -M 0.78539816339744828 -o -n sa_pi4_sin_7
+#define SA_PI4_SIN_7_TERMS 3
+#define SA_PI4_SIN_7_ERROR 3.791e-09
+static const double sa_pi4_sin_7[SA_PI4_SIN_7_TERMS] = {
+  -1.66666546095485978984385e-01,
+  +8.33216076185935329567744e-03,
+  -1.95152831920685935823342e-04
+};
+
+// remez -d 8 -m 0 -M 0.78539816339744828 -c -n sa_pi4_cos_7
+#define SA_PI4_COS_7_TERMS 4
+#define SA_PI4_COS_7_ERROR 6.374e-11
+static const double sa_pi4_cos_7[SA_PI4_COS_7_TERMS] = {
+  -4.99999996944759661499091e-01,
+  +4.16666203571296536734003e-02,
+  -1.38866816479500838898975e-03,
+  +2.43835673099407441110319e-05
+};
+
+// remez -d 9 -m 0 -M 0.78539816339744828 -o -n sa_pi4_sin_9
+#define SA_PI4_SIN_9_TERMS 4
+#define SA_PI4_SIN_9_ERROR 5.158e-12
+static const double sa_pi4_sin_9[SA_PI4_SIN_9_TERMS] = {
+  -1.66666666407970481822431e-01,
+  +8.33332930484256481640237e-03,
+  -1.98393122694568747876875e-04,
+  +2.71812162755200593437462e-06
+};
+
+// remez -d 10 -m 0 -M 0.78539816339744828 -c -n sa_pi4_cos_9
+#define SA_PI4_COS_9_TERMS 5
+#define SA_PI4_COS_9_ERROR 7.300e-14
+static const double sa_pi4_cos_9[SA_PI4_COS_9_TERMS] = {
+  -4.99999999994893806753993e-01,
+  +4.16666665534274130444636e-02,
+  -1.38888806594313247988470e-03,
+  +2.47989607347811610383106e-05,
+  -2.71747899070135582129035e-07
+};
+
+// remez -d 11 -m 0 -M 0.78539816339744828 -o -n sa_pi4_sin_11
+#define SA_PI4_SIN_11_TERMS 5
+#define SA_PI4_SIN_11_ERROR 5.002e-15
+static const double sa_pi4_sin_11[SA_PI4_SIN_11_TERMS] = {
+  -1.66666666666303503463453e-01,
+  +8.33333332507777378717062e-03,
+  -1.98412637286341615120572e-04,
+  +2.75553396564508376408555e-06,
+  -2.47604545657743010325172e-08
+};
+
+// remez -d 12 -m 0 -M 0.78539816339744828 -c -n sa_pi4_cos_11
+#define SA_PI4_COS_11_TERMS 6
+#define SA_PI4_COS_11_ERROR 8.194e-17
+static const double sa_pi4_cos_11[SA_PI4_COS_11_TERMS] = {
+  -4.99999999999994115817969e-01,
+  +4.16666666664878490577983e-02,
+  -1.38888888705916918944738e-03,
+  +2.48015786493503986875637e-05,
+  -2.75552424089023276120367e-07,
+  +2.06306363991813537206851e-09
+};
+
+// remez -d 13 -m 0 -M 0.78539816339744828 -o -n sa_pi4_sin_13
+#define SA_PI4_SIN_13_TERMS 6
+#define SA_PI4_SIN_13_ERROR 1.080e-17
+static const double sa_pi4_sin_13[SA_PI4_SIN_13_TERMS] = {
+  -1.66666666666666296592325e-01,
+  +8.33333333332211823041291e-03,
+  -1.98412698295895388025598e-04,
+  +2.75573136213856801016576e-06,
+  -2.50507477628504115658619e-08,
+  +1.58962301572197448473293e-10
+};
+
+// remez -d 14 -m 0 -M 0.78539816339744828 -c -n sa_pi4_cos_13
+#define SA_PI4_COS_13_TERMS 7
+#define SA_PI4_COS_13_ERROR 4.171e-18
+static const double sa_pi4_cos_13[SA_PI4_COS_13_TERMS] = {
+  -5.00000000000000000000000e-01,
+  +4.16666666666664700646727e-02,
+  -1.38888888888619990366613e-03,
+  +2.48015872840945973676601e-05,
+  -2.75573131172845332221362e-07,
+  +2.08755821261904558482000e-09,
+  -1.13532812098585798203781e-11
+};
+
+#define SA_PI4_7_ERROR SA_PI4_SIN_7_ERROR
+#define SA_PI4_9_ERROR SA_PI4_SIN_9_ERROR
+#define SA_PI4_11_ERROR SA_PI4_SIN_11_ERROR
+#define SA_PI4_13_ERROR SA_PI4_SIN_13_ERROR
+
+// Each instance gets its own copy of the kernel, with the table and
+// term count folded in.
+#define SA_INLINE static inline __attribute__((always_inline))
+
+static const double sa_c2DPi = 6.36619772367581382433e-01;
+static const double sa_cToInt = 6755399441055744.0;
+static const double sa_cPiD2_1 = 1.57079632679489655800e+00;
+static const double sa_cPiD2_2 = 6.12323399573676603587e-17;
+static const double sa_cPiD2_3 = -1.49738490485916983294e-33;
+static const double sa_cHuge = 1048576.0;
+
+// |x| = n*Pi/2 + hi + lo, returns n mod 4.  Cody-Waite as in sin5.c,
+// Payne-Hanek past 2^20.
+SA_INLINE int sa_reduce(double x, double *hi, double *lo) {
+  if (x >= sa_cHuge) return phReduce(x, hi, lo);
+  double t = fma(x, sa_c2DPi, sa_cToInt);
+  uint64_t bits;
+  memcpy(&bits, &t, sizeof(bits));
+  double m = t - sa_cToInt;
+  double r = fma(-m, sa_cPiD2_1, x);
+  double p = m * sa_cPiD2_2;
+  double pe = fma(m, sa_cPiD2_2, -p);
+  *hi = r - p;
+  double bb = *hi - r;
+  double e = (r - (*hi - bb)) - (p + bb);
+  *lo = fma(-m, sa_cPiD2_3, e - pe);
+  return bits & 3;
+}
+
+// c[0] + z*(c[1] + ... + z*c[terms - 1]); terms is a constant at every
+// call, so the loop unrolls.
+SA_INLINE double sa_horner(const double *c, const int terms, double z) {
+  double p = c[terms - 1];
+#pragma GCC unroll 16
+  for (int k = terms - 2; k >= 0; k--) {
+    p = fma(p, z, c[k]);
+  }
+  return p;
+}
+
+SA_INLINE double sa_kernel_pi2(double x, const double *c, const int terms) {
+  if (!isfinite(x)) return x - x;
+  int negate = signbit(x) != 0;
+  double hi, lo;
+  int n = sa_reduce(fabs(x), &hi, &lo);
+
+  negate ^= n >> 1;
+  if (signbit(hi)) {
+    hi = -hi;
+    lo = -lo;
+    negate ^= ~n & 1;
+  }
+  double y;
+  if (n & 1) {
+    double v = (sa_cPiD2_1 - hi) + (sa_cPiD2_2 - lo);
+    double z = v * v;
+    y = fma(v * z, sa_horner(c, terms, z), v);
+  } else {
+    double z = hi * hi;
+    y = hi + fma(hi * z, sa_horner(c, terms, z), lo);
+  }
+  return negate ? -y : y;
+}
+
+SA_INLINE double sa_kernel_pi4(double x, const double *s, const int sterms,
+                               const double *c, const int cterms) {
+  if (!isfinite(x)) return x - x;
+  int negate = signbit(x) != 0;
+  double hi, lo;
+  int n = sa_reduce(fabs(x), &hi, &lo);
+
+  negate ^= n >> 1;
+  double y;
+  if (n & 1) {
+    // Cos(hi + lo) ~ Cos(hi) - lo*hi.  1 - z/2 is split off and its
+    // rounding errors carried, as in sinf3.s; c[0] is -1/2 to within a
+    // few ulp, so c[0] + 1/2 is exact.
+    double z = hi * hi;
+    double ze = fma(hi, hi, -z);
+    double hz = 0.5 * z;
+    double w = 1.0 - hz;
+    double e = ((1.0 - w) - hz) - fma(0.5, ze, lo * hi);
+    double q = fma(sa_horner(c + 1, cterms - 1, z), z, c[0] + 0.5);
+    y = w + fma(z, q, e);
+  } else {
+    if (signbit(hi)) {
+      hi = -hi;
+      lo = -lo;
+      negate ^= 1;
+    }
+    double z = hi * hi;
+    y = hi + fma(hi * z, sa_horner(s, sterms, z), lo);
+  }
+  return negate ? -y : y;
+}
+
+#endif
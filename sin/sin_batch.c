@@ -0,0 +1,461 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mysin.h"
+
+// Array versions of sin_3 and sincos_3.
+//
+// Each vector kernel follows sin3.s step for step in every lane:
+// fold the sign, run the Cody-Waite reduction, use the quadrant to
+// fold the remainder onto [0, Pi/2] and run the same 14 term Horner
+// chain with fused multiply-adds.  The branches of sin3.s become
+// compare masks and blends, so the results are bit for bit those of
+// the scalar routine.  Lanes with |x| >= 2^20
+// need the Payne-Hanek reduction; they are rare, so the vector is
+// finished as usual and those lanes are redone by sin_3.  Whatever is
+// left over after the last full vector goes through sin_3 as well.
+
+static const double a[14] = {
+  +3.15159609307366933583264e-17,
+  +9.99999999999992137463981e-1,
+  +3.24848403977218879514298e-13,
+  -1.66666666671945646405887e-1,
+  +4.46929940061919965152147e-11,
+  +8.33333310712103651500584e-3,
+  +7.39903364746182917886826e-10,
+  -1.98414335571346275936300e-4,
+  +2.51241790401253696723421e-9,
+  +2.75303544969185019022074e-6,
+  +2.00650971121911487700779e-9,
+  -2.60546344930653900663444e-8,
+  +3.11243537080303902068867e-10,
+  +1.12392760716968552199773e-10
+};
+
+static const double c2DPi = 6.36619772367581382433e-01;
+static const double cToInt = 6755399441055744.0;
+static const double cPiD2_1 = 1.57079632679489655800e+00;
+static const double cPiD2_2 = 6.12323399573676603587e-17;
+static const double cPiD2_3 = -1.49738490485916983294e-33;
+static const double cHuge = 1048576.0;
+
+static void sin_3_tail(const double *x, double *y, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    y[i] = sin_3(x[i]);
+  }
+}
+
+// Redo the lanes set in mask with the scalar routine.
+static void sin_3_lanes(const double *x, double *y, unsigned mask) {
+  for (int k = 0; mask != 0; k++, mask >>= 1) {
+    if (mask & 1) y[k] = sin_3(x[k]);
+  }
+}
+
+// The same for sincos_3.  The vector sincos kernels share the
+// reduction above, then run the polynomial on both |r| and
+// Pi/2 - |r| as sincos3.s does.
+static void sincos_3_tail(const double *x, double *s, double *c, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    sincos_3(x[i], s + i, c + i);
+  }
+}
+
+static void sincos_3_lanes(const double *x, double *s, double *c, unsigned mask) {
+  for (int k = 0; mask != 0; k++, mask >>= 1) {
+    if (mask & 1) sincos_3(x[k], s + k, c + k);
+  }
+}
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+
+void sin_3_batch_neon(const double *x, double *y, size_t n) {
+  const float64x2_t two_d_pi = vdupq_n_f64(c2DPi);
+  const float64x2_t to_int = vdupq_n_f64(cToInt);
+  const float64x2_t pi_2_1 = vdupq_n_f64(cPiD2_1);
+  const float64x2_t pi_2_2 = vdupq_n_f64(cPiD2_2);
+  const float64x2_t pi_2_3 = vdupq_n_f64(cPiD2_3);
+  const float64x2_t zero = vdupq_n_f64(0.0);
+  const float64x2_t huge_x = vdupq_n_f64(cHuge);
+  const uint64x2_t sign = vdupq_n_u64(0x8000000000000000ULL);
+  const uint64x2_t one = vdupq_n_u64(1);
+  const uint64x2_t two = vdupq_n_u64(2);
+  size_t i = 0;
+
+  for (; i + 2 <= n; i += 2) {
+    float64x2_t v = vld1q_f64(x + i);
+
+    // x < 0 (or NaN): remember to negate, work with -x
+    uint64x2_t neg = vbicq_u64(sign, vcgeq_f64(v, zero));
+    v = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(v), neg));
+    uint64x2_t huge = vcgeq_f64(v, huge_x);
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo
+    float64x2_t t = vfmaq_f64(to_int, v, two_d_pi);
+    uint64x2_t q = vreinterpretq_u64_f64(t);
+    float64x2_t k = vsubq_f64(t, to_int);
+    float64x2_t r = vfmsq_f64(v, k, pi_2_1);
+    float64x2_t p = vmulq_f64(k, pi_2_2);
+    float64x2_t pe = vnegq_f64(vfmsq_f64(p, k, pi_2_2));
+    float64x2_t hi = vsubq_f64(r, p);
+    float64x2_t bb = vsubq_f64(hi, r);
+    float64x2_t e = vsubq_f64(vsubq_f64(r, vsubq_f64(hi, bb)), vaddq_f64(p, bb));
+    float64x2_t lo = vfmsq_f64(vsubq_f64(e, pe), k, pi_2_3);
+
+    // Quadrants 2 & 3 are negative.  Even quadrants take Sin(|r|) and
+    // the sign of r, odd quadrants Sin(Pi/2 - |r|).
+    neg = veorq_u64(neg, vandq_u64(vtstq_u64(q, two), sign));
+    uint64x2_t odd = vtstq_u64(q, one);
+    uint64x2_t hneg = vbicq_u64(sign, vcgeq_f64(hi, zero));
+    float64x2_t ev = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(hi), hneg));
+    uint64x2_t lneg = vandq_u64(vcltq_f64(hi, zero), sign);
+    float64x2_t lo_abs = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(lo), lneg));
+    float64x2_t od = vaddq_f64(vsubq_f64(pi_2_1, vabsq_f64(hi)), vsubq_f64(pi_2_2, lo_abs));
+    v = vbslq_f64(odd, od, ev);
+    neg = veorq_u64(neg, vbicq_u64(hneg, odd));
+
+    float64x2_t y_ = vdupq_n_f64(a[13]);
+    for (int j = 12; j >= 0; j--) {
+      y_ = vfmaq_f64(vdupq_n_f64(a[j]), y_, v);
+    }
+
+    y_ = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(y_), neg));
+    vst1q_f64(y + i, y_);
+    unsigned lanes = (vgetq_lane_u64(huge, 0) & 1) | (vgetq_lane_u64(huge, 1) & 2);
+    if (lanes) sin_3_lanes(x + i, y + i, lanes);
+  }
+  sin_3_tail(x + i, y + i, n - i);
+}
+
+void sincos_3_batch_neon(const double *x, double *s, double *c, size_t n) {
+  const float64x2_t two_d_pi = vdupq_n_f64(c2DPi);
+  const float64x2_t to_int = vdupq_n_f64(cToInt);
+  const float64x2_t pi_2_1 = vdupq_n_f64(cPiD2_1);
+  const float64x2_t pi_2_2 = vdupq_n_f64(cPiD2_2);
+  const float64x2_t pi_2_3 = vdupq_n_f64(cPiD2_3);
+  const float64x2_t zero = vdupq_n_f64(0.0);
+  const float64x2_t huge_x = vdupq_n_f64(cHuge);
+  const uint64x2_t sign = vdupq_n_u64(0x8000000000000000ULL);
+  const uint64x2_t one = vdupq_n_u64(1);
+  const uint64x2_t two = vdupq_n_u64(2);
+  size_t i = 0;
+
+  for (; i + 2 <= n; i += 2) {
+    float64x2_t v = vld1q_f64(x + i);
+
+    // x < 0 (or NaN): negate Sin, work with -x
+    uint64x2_t sneg = vbicq_u64(sign, vcgeq_f64(v, zero));
+    v = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(v), sneg));
+    uint64x2_t huge = vcgeq_f64(v, huge_x);
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo
+    float64x2_t t = vfmaq_f64(to_int, v, two_d_pi);
+    uint64x2_t q = vreinterpretq_u64_f64(t);
+    float64x2_t k = vsubq_f64(t, to_int);
+    float64x2_t r = vfmsq_f64(v, k, pi_2_1);
+    float64x2_t p = vmulq_f64(k, pi_2_2);
+    float64x2_t pe = vnegq_f64(vfmsq_f64(p, k, pi_2_2));
+    float64x2_t hi = vsubq_f64(r, p);
+    float64x2_t bb = vsubq_f64(hi, r);
+    float64x2_t e = vsubq_f64(vsubq_f64(r, vsubq_f64(hi, bb)), vaddq_f64(p, bb));
+    float64x2_t lo = vfmsq_f64(vsubq_f64(e, pe), k, pi_2_3);
+
+    // Sin is negative in quadrants 2 & 3, Cos in 1 & 2.  P(|r|) goes
+    // to Sin in even quadrants and to Cos in odd ones, and takes the
+    // sign of r; P(Pi/2 - |r|) goes to the other.
+    sneg = veorq_u64(sneg, vandq_u64(vtstq_u64(q, two), sign));
+    uint64x2_t cneg = vandq_u64(vtstq_u64(vaddq_u64(q, one), two), sign);
+    uint64x2_t odd = vtstq_u64(q, one);
+    uint64x2_t hneg = vbicq_u64(sign, vcgeq_f64(hi, zero));
+    float64x2_t ev = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(hi), hneg));
+    uint64x2_t lneg = vandq_u64(vcltq_f64(hi, zero), sign);
+    float64x2_t lo_abs = vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(lo), lneg));
+    float64x2_t od = vaddq_f64(vsubq_f64(pi_2_1, vabsq_f64(hi)), vsubq_f64(pi_2_2, lo_abs));
+    sneg = veorq_u64(sneg, vbicq_u64(hneg, odd));
+    cneg = veorq_u64(cneg, vandq_u64(hneg, odd));
+
+    float64x2_t ye = vdupq_n_f64(a[13]);
+    float64x2_t yo = ye;
+    for (int j = 12; j >= 0; j--) {
+      ye = vfmaq_f64(vdupq_n_f64(a[j]), ye, ev);
+      yo = vfmaq_f64(vdupq_n_f64(a[j]), yo, od);
+    }
+
+    float64x2_t s_ = vbslq_f64(odd, yo, ye);
+    float64x2_t c_ = vbslq_f64(odd, ye, yo);
+    vst1q_f64(s + i, vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(s_), sneg)));
+    vst1q_f64(c + i, vreinterpretq_f64_u64(veorq_u64(vreinterpretq_u64_f64(c_), cneg)));
+    unsigned lanes = (vgetq_lane_u64(huge, 0) & 1) | (vgetq_lane_u64(huge, 1) & 2);
+    if (lanes) sincos_3_lanes(x + i, s + i, c + i, lanes);
+  }
+  sincos_3_tail(x + i, s + i, c + i, n - i);
+}
+#endif
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+__attribute__((target("avx2,fma")))
+void sin_3_batch_avx2(const double *x, double *y, size_t n) {
+  const __m256d two_d_pi = _mm256_set1_pd(c2DPi);
+  const __m256d to_int = _mm256_set1_pd(cToInt);
+  const __m256d pi_2_1 = _mm256_set1_pd(cPiD2_1);
+  const __m256d pi_2_2 = _mm256_set1_pd(cPiD2_2);
+  const __m256d pi_2_3 = _mm256_set1_pd(cPiD2_3);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d huge_x = _mm256_set1_pd(cHuge);
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  size_t i = 0;
+
+  for (; i + 4 <= n; i += 4) {
+    __m256d v = _mm256_loadu_pd(x + i);
+
+    // x < 0 (or NaN): remember to negate, work with -x
+    __m256d neg = _mm256_and_pd(_mm256_cmp_pd(v, zero, _CMP_NGE_UQ), sign);
+    v = _mm256_xor_pd(v, neg);
+    int huge = _mm256_movemask_pd(_mm256_cmp_pd(v, huge_x, _CMP_GE_OQ));
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo
+    __m256d t = _mm256_fmadd_pd(v, two_d_pi, to_int);
+    __m256i q = _mm256_castpd_si256(t);
+    __m256d k = _mm256_sub_pd(t, to_int);
+    __m256d r = _mm256_fnmadd_pd(k, pi_2_1, v);
+    __m256d p = _mm256_mul_pd(k, pi_2_2);
+    __m256d pe = _mm256_fmsub_pd(k, pi_2_2, p);
+    __m256d hi = _mm256_sub_pd(r, p);
+    __m256d bb = _mm256_sub_pd(hi, r);
+    __m256d e = _mm256_sub_pd(_mm256_sub_pd(r, _mm256_sub_pd(hi, bb)),
+                              _mm256_add_pd(p, bb));
+    __m256d lo = _mm256_fnmadd_pd(k, pi_2_3, _mm256_sub_pd(e, pe));
+
+    // Quadrants 2 & 3 are negative.  Even quadrants take Sin(|r|) and
+    // the sign of r, odd quadrants Sin(Pi/2 - |r|).  Shifting the
+    // quadrant bits up to the sign bit makes them usable as masks.
+    neg = _mm256_xor_pd(neg, _mm256_and_pd(_mm256_castsi256_pd(_mm256_slli_epi64(q, 62)), sign));
+    __m256d odd = _mm256_castsi256_pd(_mm256_slli_epi64(q, 63));
+    __m256d hneg = _mm256_and_pd(_mm256_cmp_pd(hi, zero, _CMP_NGE_UQ), sign);
+    __m256d ev = _mm256_xor_pd(hi, hneg);
+    __m256d lo_abs = _mm256_xor_pd(lo, _mm256_and_pd(_mm256_cmp_pd(hi, zero, _CMP_LT_OQ), sign));
+    __m256d od = _mm256_add_pd(_mm256_sub_pd(pi_2_1, _mm256_andnot_pd(sign, hi)),
+                               _mm256_sub_pd(pi_2_2, lo_abs));
+    v = _mm256_blendv_pd(ev, od, odd);
+    neg = _mm256_xor_pd(neg, _mm256_blendv_pd(hneg, zero, odd));
+
+    __m256d y_ = _mm256_set1_pd(a[13]);
+    for (int j = 12; j >= 0; j--) {
+      y_ = _mm256_fmadd_pd(y_, v, _mm256_set1_pd(a[j]));
+    }
+
+    _mm256_storeu_pd(y + i, _mm256_xor_pd(y_, neg));
+    if (huge) sin_3_lanes(x + i, y + i, huge);
+  }
+  sin_3_tail(x + i, y + i, n - i);
+}
+
+__attribute__((target("avx2,fma")))
+void sincos_3_batch_avx2(const double *x, double *s, double *c, size_t n) {
+  const __m256d two_d_pi = _mm256_set1_pd(c2DPi);
+  const __m256d to_int = _mm256_set1_pd(cToInt);
+  const __m256d pi_2_1 = _mm256_set1_pd(cPiD2_1);
+  const __m256d pi_2_2 = _mm256_set1_pd(cPiD2_2);
+  const __m256d pi_2_3 = _mm256_set1_pd(cPiD2_3);
+  const __m256d zero = _mm256_setzero_pd();
+  const __m256d huge_x = _mm256_set1_pd(cHuge);
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256i one = _mm256_set1_epi64x(1);
+  size_t i = 0;
+
+  for (; i + 4 <= n; i += 4) {
+    __m256d v = _mm256_loadu_pd(x + i);
+
+    // x < 0 (or NaN): negate Sin, work with -x
+    __m256d sneg = _mm256_and_pd(_mm256_cmp_pd(v, zero, _CMP_NGE_UQ), sign);
+    v = _mm256_xor_pd(v, sneg);
+    int huge = _mm256_movemask_pd(_mm256_cmp_pd(v, huge_x, _CMP_GE_OQ));
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo
+    __m256d t = _mm256_fmadd_pd(v, two_d_pi, to_int);
+    __m256i q = _mm256_castpd_si256(t);
+    __m256d k = _mm256_sub_pd(t, to_int);
+    __m256d r = _mm256_fnmadd_pd(k, pi_2_1, v);
+    __m256d p = _mm256_mul_pd(k, pi_2_2);
+    __m256d pe = _mm256_fmsub_pd(k, pi_2_2, p);
+    __m256d hi = _mm256_sub_pd(r, p);
+    __m256d bb = _mm256_sub_pd(hi, r);
+    __m256d e = _mm256_sub_pd(_mm256_sub_pd(r, _mm256_sub_pd(hi, bb)),
+                              _mm256_add_pd(p, bb));
+    __m256d lo = _mm256_fnmadd_pd(k, pi_2_3, _mm256_sub_pd(e, pe));
+
+    // Sin is negative in quadrants 2 & 3, Cos in 1 & 2.  P(|r|) goes
+    // to Sin in even quadrants and to Cos in odd ones, and takes the
+    // sign of r; P(Pi/2 - |r|) goes to the other.
+    sneg = _mm256_xor_pd(sneg, _mm256_and_pd(_mm256_castsi256_pd(_mm256_slli_epi64(q, 62)), sign));
+    __m256d cneg = _mm256_and_pd(_mm256_castsi256_pd(_mm256_slli_epi64(_mm256_add_epi64(q, one), 62)), sign);
+    __m256d odd = _mm256_castsi256_pd(_mm256_slli_epi64(q, 63));
+    __m256d hneg = _mm256_and_pd(_mm256_cmp_pd(hi, zero, _CMP_NGE_UQ), sign);
+    __m256d ev = _mm256_xor_pd(hi, hneg);
+    __m256d lo_abs = _mm256_xor_pd(lo, _mm256_and_pd(_mm256_cmp_pd(hi, zero, _CMP_LT_OQ), sign));
+    __m256d od = _mm256_add_pd(_mm256_sub_pd(pi_2_1, _mm256_andnot_pd(sign, hi)),
+                               _mm256_sub_pd(pi_2_2, lo_abs));
+    sneg = _mm256_xor_pd(sneg, _mm256_blendv_pd(hneg, zero, odd));
+    cneg = _mm256_xor_pd(cneg, _mm256_blendv_pd(zero, hneg, odd));
+
+    __m256d ye = _mm256_set1_pd(a[13]);
+    __m256d yo = ye;
+    for (int j = 12; j >= 0; j--) {
+      ye = _mm256_fmadd_pd(ye, ev, _mm256_set1_pd(a[j]));
+      yo = _mm256_fmadd_pd(yo, od, _mm256_set1_pd(a[j]));
+    }
+
+    _mm256_storeu_pd(s + i, _mm256_xor_pd(_mm256_blendv_pd(ye, yo, odd), sneg));
+    _mm256_storeu_pd(c + i, _mm256_xor_pd(_mm256_blendv_pd(yo, ye, odd), cneg));
+    if (huge) sincos_3_lanes(x + i, s + i, c + i, huge);
+  }
+  sincos_3_tail(x + i, s + i, c + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+void sin_3_batch_avx512(const double *x, double *y, size_t n) {
+  const __m512d two_d_pi = _mm512_set1_pd(c2DPi);
+  const __m512d to_int = _mm512_set1_pd(cToInt);
+  const __m512d pi_2_1 = _mm512_set1_pd(cPiD2_1);
+  const __m512d pi_2_2 = _mm512_set1_pd(cPiD2_2);
+  const __m512d pi_2_3 = _mm512_set1_pd(cPiD2_3);
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d huge_x = _mm512_set1_pd(cHuge);
+  const __m512i sign = _mm512_set1_epi64(0x8000000000000000LL);
+  const __m512i one = _mm512_set1_epi64(1);
+  const __m512i two = _mm512_set1_epi64(2);
+  size_t i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m512d v = _mm512_loadu_pd(x + i);
+
+    // x < 0 (or NaN): remember to negate, work with -x
+    __mmask8 m = _mm512_cmp_pd_mask(v, zero, _CMP_NGE_UQ);
+    __m512i neg = _mm512_maskz_mov_epi64(m, sign);
+    v = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v), neg));
+    __mmask8 huge = _mm512_cmp_pd_mask(v, huge_x, _CMP_GE_OQ);
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo
+    __m512d t = _mm512_fmadd_pd(v, two_d_pi, to_int);
+    __m512i q = _mm512_castpd_si512(t);
+    __m512d k = _mm512_sub_pd(t, to_int);
+    __m512d r = _mm512_fnmadd_pd(k, pi_2_1, v);
+    __m512d p = _mm512_mul_pd(k, pi_2_2);
+    __m512d pe = _mm512_fmsub_pd(k, pi_2_2, p);
+    __m512d hi = _mm512_sub_pd(r, p);
+    __m512d bb = _mm512_sub_pd(hi, r);
+    __m512d e = _mm512_sub_pd(_mm512_sub_pd(r, _mm512_sub_pd(hi, bb)),
+                              _mm512_add_pd(p, bb));
+    __m512d lo = _mm512_fnmadd_pd(k, pi_2_3, _mm512_sub_pd(e, pe));
+
+    // Quadrants 2 & 3 are negative.  Even quadrants take Sin(|r|) and
+    // the sign of r, odd quadrants Sin(Pi/2 - |r|).
+    neg = _mm512_mask_xor_epi64(neg, _mm512_test_epi64_mask(q, two), neg, sign);
+    __mmask8 odd = _mm512_test_epi64_mask(q, one);
+    __mmask8 hneg = _mm512_cmp_pd_mask(hi, zero, _CMP_NGE_UQ);
+    __m512i hbits = _mm512_castpd_si512(hi);
+    __m512d ev = _mm512_castsi512_pd(_mm512_mask_xor_epi64(hbits, hneg, hbits, sign));
+    __m512i lbits = _mm512_castpd_si512(lo);
+    __mmask8 lneg = _mm512_cmp_pd_mask(hi, zero, _CMP_LT_OQ);
+    __m512d lo_abs = _mm512_castsi512_pd(_mm512_mask_xor_epi64(lbits, lneg, lbits, sign));
+    __m512d hi_abs = _mm512_castsi512_pd(_mm512_andnot_si512(sign, hbits));
+    __m512d od = _mm512_add_pd(_mm512_sub_pd(pi_2_1, hi_abs), _mm512_sub_pd(pi_2_2, lo_abs));
+    v = _mm512_mask_mov_pd(ev, odd, od);
+    neg = _mm512_mask_xor_epi64(neg, hneg & ~odd, neg, sign);
+
+    __m512d y_ = _mm512_set1_pd(a[13]);
+    for (int j = 12; j >= 0; j--) {
+      y_ = _mm512_fmadd_pd(y_, v, _mm512_set1_pd(a[j]));
+    }
+
+    y_ = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(y_), neg));
+    _mm512_storeu_pd(y + i, y_);
+    if (huge) sin_3_lanes(x + i, y + i, huge);
+  }
+  sin_3_tail(x + i, y + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+void sincos_3_batch_avx512(const double *x, double *s, double *c, size_t n) {
+  const __m512d two_d_pi = _mm512_set1_pd(c2DPi);
+  const __m512d to_int = _mm512_set1_pd(cToInt);
+  const __m512d pi_2_1 = _mm512_set1_pd(cPiD2_1);
+  const __m512d pi_2_2 = _mm512_set1_pd(cPiD2_2);
+  const __m512d pi_2_3 = _mm512_set1_pd(cPiD2_3);
+  const __m512d zero = _mm512_setzero_pd();
+  const __m512d huge_x = _mm512_set1_pd(cHuge);
+  const __m512i sign = _mm512_set1_epi64(0x8000000000000000LL);
+  const __m512i one = _mm512_set1_epi64(1);
+  const __m512i two = _mm512_set1_epi64(2);
+  size_t i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m512d v = _mm512_loadu_pd(x + i);
+
+    // x < 0 (or NaN): negate Sin, work with -x
+    __mmask8 m = _mm512_cmp_pd_mask(v, zero, _CMP_NGE_UQ);
+    __m512i sneg = _mm512_maskz_mov_epi64(m, sign);
+    v = _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(v), sneg));
+    __mmask8 huge = _mm512_cmp_pd_mask(v, huge_x, _CMP_GE_OQ);
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo
+    __m512d t = _mm512_fmadd_pd(v, two_d_pi, to_int);
+    __m512i q = _mm512_castpd_si512(t);
+    __m512d k = _mm512_sub_pd(t, to_int);
+    __m512d r = _mm512_fnmadd_pd(k, pi_2_1, v);
+    __m512d p = _mm512_mul_pd(k, pi_2_2);
+    __m512d pe = _mm512_fmsub_pd(k, pi_2_2, p);
+    __m512d hi = _mm512_sub_pd(r, p);
+    __m512d bb = _mm512_sub_pd(hi, r);
+    __m512d e = _mm512_sub_pd(_mm512_sub_pd(r, _mm512_sub_pd(hi, bb)),
+                              _mm512_add_pd(p, bb));
+    __m512d lo = _mm512_fnmadd_pd(k, pi_2_3, _mm512_sub_pd(e, pe));
+
+    // Sin is negative in quadrants 2 & 3, Cos in 1 & 2.  P(|r|) goes
+    // to Sin in even quadrants and to Cos in odd ones, and takes the
+    // sign of r; P(Pi/2 - |r|) goes to the other.
+    sneg = _mm512_mask_xor_epi64(sneg, _mm512_test_epi64_mask(q, two), sneg, sign);
+    __m512i cneg = _mm512_maskz_mov_epi64(
+        _mm512_test_epi64_mask(_mm512_add_epi64(q, one), two), sign);
+    __mmask8 odd = _mm512_test_epi64_mask(q, one);
+    __mmask8 hneg = _mm512_cmp_pd_mask(hi, zero, _CMP_NGE_UQ);
+    __m512i hbits = _mm512_castpd_si512(hi);
+    __m512d ev = _mm512_castsi512_pd(_mm512_mask_xor_epi64(hbits, hneg, hbits, sign));
+    __m512i lbits = _mm512_castpd_si512(lo);
+    __mmask8 lneg = _mm512_cmp_pd_mask(hi, zero, _CMP_LT_OQ);
+    __m512d lo_abs = _mm512_castsi512_pd(_mm512_mask_xor_epi64(lbits, lneg, lbits, sign));
+    __m512d hi_abs = _mm512_castsi512_pd(_mm512_andnot_si512(sign, hbits));
+    __m512d od = _mm512_add_pd(_mm512_sub_pd(pi_2_1, hi_abs), _mm512_sub_pd(pi_2_2, lo_abs));
+    sneg = _mm512_mask_xor_epi64(sneg, hneg & ~odd, sneg, sign);
+    cneg = _mm512_mask_xor_epi64(cneg, hneg & odd, cneg, sign);
+
+    __m512d ye = _mm512_set1_pd(a[13]);
+    __m512d yo = ye;
+    for (int j = 12; j >= 0; j--) {
+      ye = _mm512_fmadd_pd(ye, ev, _mm512_set1_pd(a[j]));
+      yo = _mm512_fmadd_pd(yo, od, _mm512_set1_pd(a[j]));
+    }
+
+    __m512d s_ = _mm512_mask_mov_pd(ye, odd, yo);
+    __m512d c_ = _mm512_mask_mov_pd(yo, odd, ye);
+    _mm512_storeu_pd(s + i, _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(s_), sneg)));
+    _mm512_storeu_pd(c + i, _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(c_), cneg)));
+    if (huge) sincos_3_lanes(x + i, s + i, c + i, huge);
+  }
+  sincos_3_tail(x + i, s + i, c + i, n - i);
+}
+#endif
+
+// One element at a time, where there is no vector unit to use.
+// dispatch.c binds sin_3_batch and sincos_3_batch to one of these.
+
+void sin_3_batch_scalar(const double *x, double *y, size_t n) {
+  sin_3_tail(x, y, n);
+}
+
+void sincos_3_batch_scalar(const double *x, double *s, double *c, size_t n) {
+  sincos_3_tail(x, s, c, n);
+}
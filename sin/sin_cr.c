@@ -0,0 +1,230 @@
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <stdatomic.h>
+
+#include "dd.h"
+#include "variant.h"
+#include "mysin.h"
+#include "sintab.h"
+
+// Correctly rounded Sin(x), after the fast and accurate passes of sin
+// in LLVM libc (refs/llvm_sin.cpp) and __sin in glibc (refs/s_sin.c).
+//
+// The fast pass is sin_5 carried out in double-double: the same
+// reduction and 128 node table, with Sin(d) and Cos(d) to degree 7 and
+// 8, and the leading products and sums kept exact, so that the result
+// comes out as y = hi + lo with |y - Sin(x)| < 2^-68 |y|.  Ziv's test
+// asks whether hi + (lo - err) and hi + (lo + err) round the same way;
+// if they do, that is the correctly rounded answer.  For random x they
+// fail about once in 2^14 calls.
+//
+// Then the accurate pass starts over with 128 bit fixed point: the
+// Payne-Hanek reduction to 128 bits (phReduce128), and the Taylor
+// series of Sin and Cos on |r| <= Pi/4 summed to 2^-127.  Its error is
+// below 2^-117, and if the result is within that of a rounding
+// boundary it is counted as undecided and rounded anyway.  No such x
+// has turned up.
+//
+// Round to nearest is assumed.
+
+static const double c2DPi = 6.36619772367581382433e-01;
+static const double cToInt = 6755399441055744.0;
+static const double cPiD2_1 = 1.57079632679489655800e+00;
+static const double cPiD2_2 = 6.12323399573676603587e-17;
+static const double cPiD2_3 = -1.49738490485916983294e-33;
+static const double cHuge = 1048576.0;
+static const double cTiny = 1.4901161193847656e-08;     // 2^-26
+
+// Sin(d) - d = d^3*(S3 + d^2*(S5 + d^2*S7)) to within 2^-93 |d|,
+// Cos(d) - 1 = d^2*C2 + d^4*(C4 + d^2*(C6 + d^2*C8)) to within 2^-105
+static const double S3 = -1.66666666666666666667e-01;
+static const double S5 = 8.33333333333333333333e-03;
+static const double S7 = -1.98412698412698412698e-04;
+static const double C4 = 4.16666666666666666667e-02;
+static const double C6 = -1.38888888888888888889e-03;
+static const double C8 = 2.48015873015873015873e-05;
+
+// The fast pass's bound, relative to |hi|.  The worst case is just past
+// Pi/1024, where the first node is nearest and Cos(h)*d cancels half
+// of Sin(h): the half dozen roundings in the Sin(d) - d term, up to
+// 2^-19 of the result, add up to about 2^-69.5.  The worst seen is
+// 2^-69.3.
+static const double cErr = 0x1p-68;
+
+static _Atomic uint64_t slow_calls;
+static _Atomic uint64_t undecided_calls;
+
+void sin_cr_counts(uint64_t *slow, uint64_t *undecided) {
+  *slow = atomic_load_explicit(&slow_calls, memory_order_relaxed);
+  *undecided = atomic_load_explicit(&undecided_calls, memory_order_relaxed);
+}
+
+// The fast pass for finite |x| >= 2^-26: Sin(x) = hi + lo, negated if
+// the return value is 1.
+static inline int sin_cr_fast_kernel(double x, double *yh, double *yl) {
+  double hi, lo;
+  int n;
+
+  if (fabs(x) < cHuge) {
+    // Cody-Waite, as cwReduce in angle_reduction.c
+    double t = fma(x, c2DPi, cToInt);
+    uint64_t bits;
+    memcpy(&bits, &t, sizeof(bits));
+    double m = t - cToInt;
+    double r = fma(-m, cPiD2_1, x);
+    double p = m * cPiD2_2;
+    double pe = fma(m, cPiD2_2, -p);
+    hi = r - p;
+    double bb = hi - r;
+    double e = (r - (hi - bb)) - (p + bb);
+    lo = fma(-m, cPiD2_3, e - pe);
+    n = bits & 3;
+  } else {
+    n = phReduce(x, &hi, &lo);
+  }
+
+  int negate = n >> 1;
+  if (signbit(hi)) {
+    hi = -hi;
+    lo = -lo;
+    negate ^= ~n & 1;
+  }
+
+  // |r| = k*h + d + dx, h = Pi/512, as in sin_5
+  double t = fma(hi, c2DPi * 256, cToInt);
+  double k = t - cToInt;
+  double d = fma(-k, cPiD2_1 / 256, hi);
+  double dx = fma(-k, cPiD2_2 / 256, lo);
+  const struct sintab_entry *e = &sintab_128[(int)k];
+
+  // Sin(d + dx) = d + dx + st, Cos(d + dx) = 1 + ch + cl
+  double z = d * d;
+  double st = d * z * (S3 + z * (S5 + z * S7)) - 0.5 * z * dx;
+  double ch = -0.5 * z;
+  double cl = -(0.5 * fma(d, d, -z) + d * dx) + z * z * (C4 + z * (C6 + z * C8));
+
+  // Sin(k*h + u) = sn*Cos(u) + cs*Sin(u), Cos(k*h + u) = cs*Cos(u) - sn*Sin(u).
+  // The first two terms of each, and the largest part of Cos(u) - 1
+  // times the node, are added exactly.  Of the rest the node times
+  // Sin(d) - d is the largest by far, up to 2^-19 of the result, so it
+  // goes in last, to be rounded once.
+  if (n & 1) {
+    dd p = two_prod(e->sn, d);
+    dd h = two_sum(e->cs, -p.hi);
+    dd q = two_prod(e->cs, ch);
+    dd y = two_sum(h.hi, q.hi);
+    *yh = y.hi;
+    *yl = (((((((h.lo + y.lo) - p.lo) + q.lo) + e->ccs) - e->ssn * d) + e->ccs * ch)
+           + e->cs * cl - e->sn * dx) - e->sn * st;
+  } else {
+    dd p = two_prod(e->cs, d);
+    dd h = two_sum(e->sn, p.hi);
+    dd q = two_prod(e->sn, ch);
+    dd y = two_sum(h.hi, q.hi);
+    *yh = y.hi;
+    *yl = (((((((h.lo + y.lo) + p.lo) + q.lo) + e->ssn) + e->ccs * d) + e->ssn * ch)
+           + e->sn * cl + e->cs * dx) + e->cs * st;
+  }
+  return negate;
+}
+
+double sin_cr_fast(double x) {
+  if (!isfinite(x)) return x - x;
+  if (fabs(x) < cTiny) return x;
+  double hi, lo;
+  int negate = sin_cr_fast_kernel(x, &hi, &lo);
+  double y = hi + lo;
+  return negate ? -y : y;
+}
+
+// The accurate pass.  Fixed point numbers have 127 fraction bits, so
+// 1 is 2^127 and fits.
+
+typedef unsigned __int128 u128;
+
+#define TERMS 17                // Sin to r^35/35!, Cos to r^34/34!
+
+static u128 inv_fact[2 * TERMS + 2];
+
+__attribute__((constructor)) static void init_inv_fact(void) {
+  inv_fact[0] = (u128)1 << 127;
+  for (int n = 1; n < 2 * TERMS + 2; n++) {
+    inv_fact[n] = inv_fact[n - 1] / n;
+  }
+}
+
+// floor(a*b / 2^s) for a, b < 2^128, taking the top 128 bits of the
+// 256 bit product when s = 128.
+static inline u128 mul_shift(u128 a, u128 b, int s) {
+  uint64_t a1 = a >> 64, a0 = (uint64_t)a;
+  uint64_t b1 = b >> 64, b0 = (uint64_t)b;
+  u128 hh = (u128)a1 * b1;
+  u128 hl = (u128)a1 * b0;
+  u128 lh = (u128)a0 * b1;
+  u128 ll = (u128)a0 * b0;
+  u128 mid = (hl & UINT64_MAX) + (lh & UINT64_MAX) + (ll >> 64);
+  u128 top = hh + (hl >> 64) + (lh >> 64) + (mid >> 64);
+  u128 bottom = mid << 64 | (uint64_t)ll;
+  return s == 128 ? top : top << (128 - s) | bottom >> s;
+}
+
+// Error of the accurate pass, in units of the last of 128 bits
+#define ACCURATE_ERR ((u128)1 << 10)
+
+static double sin_cr_accurate(double x) {
+  int neg, e;
+  u128 r;
+  int n = phReduce128(x, &neg, &r, &e);
+
+  // z = r^2 in fixed point; |r| = r*2^(e - 127) <= Pi/4
+  u128 rf = e <= -128 ? 0 : r >> -e;
+  u128 z = mul_shift(rf, rf, 127);
+  u128 s = inv_fact[2 * TERMS + 1];
+  u128 c = inv_fact[2 * TERMS];
+  for (int k = TERMS - 1; k >= 0; k--) {
+    s = inv_fact[2 * k + 1] - mul_shift(z, s, 127);
+    c = inv_fact[2 * k] - mul_shift(z, c, 127);
+  }
+
+  // The result m*2^(e - 127), m normalized
+  u128 m;
+  if (n & 1) {                  // +-Cos(r)
+    m = c;
+    e = 0;
+    neg = n >> 1;
+  } else {                      // +-r*Sin(r)/r
+    m = mul_shift(r, s, 127);
+    neg ^= n >> 1;
+  }
+  if (m == 0) return neg ? -0.0 : 0.0;
+  while (!(m >> 127)) {
+    m <<= 1;
+    e--;
+  }
+
+  // Round to 53 bits; the result is never subnormal.
+  uint64_t y = m >> 75;
+  u128 rest = m & (((u128)1 << 75) - 1);
+  u128 half = (u128)1 << 74;
+  if ((rest > half ? rest - half : half - rest) <= ACCURATE_ERR) {
+    atomic_fetch_add_explicit(&undecided_calls, 1, memory_order_relaxed);
+  }
+  if (rest > half || (rest == half && (y & 1))) y++;
+  double v = ldexp((double)y, e - 52);
+  return neg ? -v : v;
+}
+
+double sin_cr(double x) {
+  if (!isfinite(x)) return x - x;
+  // Sin(x) = x - x^3/6 and x^2/6 is below half an ulp
+  if (fabs(x) < cTiny) return x;
+  double hi, lo;
+  int negate = sin_cr_fast_kernel(x, &hi, &lo);
+  double err = cErr * fabs(hi);
+  double y = hi + (lo + err);
+  if (y == hi + (lo - err)) return negate ? -y : y;
+
+  atomic_fetch_add_explicit(&slow_calls, 1, memory_order_relaxed);
+  return sin_cr_accurate(x);
+}
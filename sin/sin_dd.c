@@ -0,0 +1,95 @@
+#include <math.h>
+
+#include "dd.h"
+#include "variant.h"
+#include "mysin.h"
+#include "sintab.h"
+
+// Sin(x) as an unevaluated double-double, for callers that carry the
+// sum on in double-double and would lose the low bits to rounding.
+//
+// This is sin_5 again, on the 256 node table, with every step in
+// double-double: the reduction keeps both words of cwReduce or
+// phReduce, Sin(d) and Cos(d) go to d^11 and d^10, and the addition
+// formula is done with dd_mul and dd_add.  The result is within
+// 2^-100 of Sin(x), relative.
+
+static const double cHuge = 1048576.0;
+static const double cToInt = 6755399441055744.0;
+static const double c2DPi = 6.36619772367581382433e-01;
+
+// 1/n!, n = 2..5, to double-double precision
+static const dd cInvFact2 = {0x1p-1, 0.0};
+static const dd cInvFact3 = {0x1.5555555555555p-3, 0x1.5555555555555p-57};
+static const dd cInvFact4 = {0x1.5555555555555p-5, 0x1.5555555555555p-59};
+static const dd cInvFact5 = {0x1.1111111111111p-7, 0x1.1111111111111p-63};
+
+// Cody-Waite carries Pi/2 to about 2^-160 and so the remainder to about
+// 2^-160 x, too few good bits when it is below 2^-30 x; Payne-Hanek
+// keeps them all.
+static const double cNearMultiple = 0x1p-30;
+
+static inline dd sin_dd_kernel(double x) {
+  if (!isfinite(x)) return dd_make(x - x, 0.0);
+  // +-0 as it is; the reduction below would lose the sign.  Unlike
+  // sin_cr there is no tiny range, x^3/6 is still in the lo word.
+  if (x == 0.0) return dd_make(x, 0.0);
+
+  double hi, lo;
+  int n;
+  if (fabs(x) < cHuge) {
+    n = cwReduce(x, &hi, &lo);
+    if (fabs(hi) < fabs(x) * cNearMultiple) n = phReduce(x, &hi, &lo);
+  } else {
+    n = phReduce(x, &hi, &lo);
+  }
+  dd r = fast_two_sum(hi, lo);
+
+  // Quadrants 2 and 3 are negative, and so is Sin(r) for r < 0.
+  int negate = (n >> 1) & 1;
+  if (r.hi < 0.0) {
+    r = dd_neg(r);
+    negate ^= ~n & 1;
+  }
+
+  // |r| = k*h + d, h = Pi/1024 as dd_pi_2/512, the table's nodes
+  double k = fma(r.hi, c2DPi * 512, cToInt) - cToInt;
+  dd node = dd_mul_d(dd_pi_2, k / 512);
+  dd d = dd_sub(r, node);
+  const struct sintab_entry *e = &sintab_256[(int)k];
+
+  // Sin(d) = d - d^3/3! + d^5/5! - ..., Cos(d) = 1 - d^2/2! + d^4/4! - ...
+  // Past d^5 and d^4 the terms are below 2^-60 of the sum.
+  dd d2 = dd_mul(d, d);
+  double z = d2.hi;
+  double st = z * (-1.0 / 5040 + z * (1.0 / 362880 - z * (1.0 / 39916800)));
+  double ct = z * (-1.0 / 720 + z * (1.0 / 40320 - z * (1.0 / 3628800)));
+  dd ps = dd_sub(dd_mul(d2, dd_add_d(cInvFact5, st)), cInvFact3);
+  dd pc = dd_sub(dd_mul(d2, dd_add_d(cInvFact4, ct)), cInvFact2);
+  dd sd = dd_add(d, dd_mul(dd_mul(d, d2), ps));
+  dd cd = dd_add_d(dd_mul(d2, pc), 1.0);
+
+  dd sn = dd_make(e->sn, e->ssn);
+  dd cs = dd_make(e->cs, e->ccs);
+  dd y;
+  if (n & 1) {
+    y = dd_sub(dd_mul(cs, cd), dd_mul(sn, sd));
+  } else {
+    y = dd_add(dd_mul(sn, cd), dd_mul(cs, sd));
+  }
+  return negate ? dd_neg(y) : y;
+}
+
+void sin_dd(double x, double *hi, double *lo) {
+  dd y = sin_dd_kernel(x);
+  *hi = y.hi;
+  *lo = y.lo;
+}
+
+void sin_dd_batch(const double *x, double *hi, double *lo, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    dd y = sin_dd_kernel(x[i]);
+    hi[i] = y.hi;
+    lo[i] = y.lo;
+  }
+}
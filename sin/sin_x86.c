@@ -0,0 +1,332 @@
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// The assembly kernels (sin1.s ... sinf3.s, sin3b.s, reduce.s) for x86-64, so
+// the library builds as ELF for Linux.  Each function is the same
+// sequence of operations as its .s file, with the same constants:
+// fma() stands for fmadd/fmsub, and the file is compiled with -mfma
+// and -ffp-contract=off, so every fma is one vfmadd and nothing else
+// is fused.  The results are bit for bit those of the arm64 kernels.
+//
+// The file is built twice, with -mfma as the _fma kernels and without
+// as the _generic ones, where fma() is the C library's: slow, but the
+// same results on an x86-64 without FMA.  dispatch.c binds the plain
+// names to one or the other at load time (variant.h).
+
+#ifndef KERNEL_SUFFIX
+#define KERNEL_SUFFIX _fma
+#endif
+#include "variant.h"
+#include "mysin.h"
+
+#define INLINE static inline __attribute__((always_inline))
+
+// sin_3's polynomial on [0, Pi/2]
+static const double a[14] = {
+  +3.15159609307366933583264e-17, +9.99999999999992137463981e-1,
+  +3.24848403977218879514298e-13, -1.66666666671945646405887e-1,
+  +4.46929940061919965152147e-11, +8.33333310712103651500584e-3,
+  +7.39903364746182917886826e-10, -1.98414335571346275936300e-4,
+  +2.51241790401253696723421e-9,  +2.75303544969185019022074e-6,
+  +2.00650971121911487700779e-9,  -2.60546344930653900663444e-8,
+  +3.11243537080303902068867e-10, +1.12392760716968552199773e-10,
+};
+
+static const double c2DPi = +6.36619772367581382433e-01;    // 2/Pi
+static const double cToInt = +6755399441055744.0;           // 1.5*2^52
+static const double cPiD2_1 = +1.57079632679489655800e+00;  // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+static const double cPiD2_2 = +6.12323399573676603587e-17;
+static const double cPiD2_3 = -1.49738490485916983294e-33;
+static const double cHuge = +1048576.0;
+
+// sin1.s
+double KERNEL(sin_1)(double x) {
+  return x - x * x * x / 6.0;
+}
+
+// sin2.s, the polynomial with no reduction
+double KERNEL(sin_2)(double x) {
+  double p = a[13];
+  for (int i = 12; i >= 0; i--) p = fma(p, x, a[i]);
+  return p;
+}
+
+// The Cody-Waite steps inlined in sin3.s, the same as cwReduce.
+INLINE int cw_reduce(double x, double *hi, double *lo) {
+  double t = fma(x, c2DPi, cToInt);
+  uint64_t bits;
+  memcpy(&bits, &t, sizeof(bits));
+  double n = t - cToInt;
+  double r = fma(-n, cPiD2_1, x);
+  double p = n * cPiD2_2;
+  double pe = fma(n, cPiD2_2, -p);
+  double h = r - p;
+  double bb = h - r;
+  double e = (r - (h - bb)) - (p + bb);
+  *hi = h;
+  *lo = fma(-n, cPiD2_3, e - pe);
+  return bits & 3;
+}
+
+// |x| = n*Pi/2 + hi + lo for x >= 0 (or NaN)
+INLINE int reduce_pos(double x, double *hi, double *lo) {
+  if (x >= cHuge) return phReduce(x, hi, lo) & 3;
+  return cw_reduce(x, hi, lo);
+}
+
+// The argument of sin_3's polynomial, 0 <= t <= Pi/2, with Sin(x) =
+// P(t) negated if *neg.  The quadrant steps of sin3.s.
+INLINE double fold(double x, int *neg) {
+  *neg = 0;
+  if (!(x >= 0.0)) {
+    *neg = 1;
+    x = -x;
+  }
+  double hi, lo;
+  int n = reduce_pos(x, &hi, &lo);
+  if (n & 2) *neg ^= 1;
+  if (n & 1) {                  // Cos(r) = Sin(Pi/2 - |r|)
+    if (hi < 0.0) lo = -lo;
+    return (cPiD2_1 - fabs(hi)) + (cPiD2_2 - lo);
+  }
+  if (!(hi >= 0.0)) {
+    *neg ^= 1;
+    hi = -hi;
+  }
+  return hi;
+}
+
+// sin3.s
+double KERNEL(sin_3)(double x) {
+  int neg;
+  double t = fold(x, &neg);
+  double p = a[13];
+  for (int i = 12; i >= 0; i--) p = fma(p, t, a[i]);
+  return neg ? -p : p;
+}
+
+// sin3b.s, with no branches but the one for tiny, huge, Inf and NaN.
+// The selects are written as masks so the compiler keeps them that way.
+static const uint64_t cTinyBits = 0x3e50000000000000;   // 2^-26
+static const uint64_t cHugeBits = 0x4130000000000000;   // 2^20
+static const uint64_t cInfBits = 0x7ff0000000000000;
+
+INLINE double select(uint64_t mask, double a, double b) {
+  uint64_t ia, ib;
+  memcpy(&ia, &a, sizeof(ia));
+  memcpy(&ib, &b, sizeof(ib));
+  ia = (ia & mask) | (ib & ~mask);
+  memcpy(&a, &ia, sizeof(a));
+  return a;
+}
+
+double KERNEL(sin_3b)(double x) {
+  uint64_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  uint64_t neg = bits >> 63;
+  uint64_t abs_bits = bits & 0x7fffffffffffffff;
+  double hi, lo;
+  int n;
+  if (__builtin_expect(abs_bits - cTinyBits >= cHugeBits - cTinyBits, 0)) {
+    if (abs_bits < cTinyBits) return x;
+    if (abs_bits >= cInfBits) return x - x;
+    n = phReduce(fabs(x), &hi, &lo) & 3;
+  } else {
+    n = cw_reduce(fabs(x), &hi, &lo);
+  }
+  uint64_t r_neg = hi < 0.0;
+  neg ^= (n >> 1) & 1;
+  neg ^= r_neg & ~n & 1;
+  lo = select(-r_neg, -lo, lo);
+  hi = fabs(hi);
+  double q = (cPiD2_1 - hi) + (cPiD2_2 - lo);
+  double t = select(-(uint64_t)(n & 1), q, hi);
+  double p = a[13];
+#pragma GCC unroll 13
+  for (int i = 12; i >= 0; i--) p = fma(p, t, a[i]);
+  memcpy(&bits, &p, sizeof(bits));
+  bits ^= neg << 63;
+  memcpy(&p, &bits, sizeof(p));
+  return p;
+}
+
+// sin3e.s, Estrin's scheme
+double KERNEL(sin_3e)(double x) {
+  int neg;
+  double t = fold(x, &neg);
+  double t2 = t * t;
+  double p01 = fma(a[1], t, a[0]);
+  double p23 = fma(a[3], t, a[2]);
+  double p45 = fma(a[5], t, a[4]);
+  double p67 = fma(a[7], t, a[6]);
+  double p89 = fma(a[9], t, a[8]);
+  double p1011 = fma(a[11], t, a[10]);
+  double p1213 = fma(a[13], t, a[12]);
+  double t4 = t2 * t2;
+  double p03 = fma(p23, t2, p01);
+  double p47 = fma(p67, t2, p45);
+  double p811 = fma(p1011, t2, p89);
+  double t8 = t4 * t4;
+  double p07 = fma(p47, t4, p03);
+  double p813 = fma(p1213, t4, p811);
+  double p = fma(p813, t8, p07);
+  return neg ? -p : p;
+}
+
+// sin4.s, odd polynomial x + x^3*P(x^2)
+static const double c4[7] = {
+  -1.66666666666661855700227e-01, +8.33333333328554158592194e-03,
+  -1.98412698250562591264362e-04, +2.75573166005527716508183e-06,
+  -2.50518802738688894710702e-08, +1.60480954050756855128200e-10,
+  -7.37334453387496351913116e-13,
+};
+
+// fold for sin4.s, which also keeps the lo word of |r| in even
+// quadrants, where |hi| can be as small as lo near a multiple of Pi/2
+// (odd ones fold it into t), and takes the sign of -0 as negative.
+INLINE double fold_lo(double x, int *neg, double *t_lo) {
+  *neg = signbit(x) != 0;
+  double hi, lo;
+  int n = reduce_pos(fabs(x), &hi, &lo);
+  if (n & 2) *neg ^= 1;
+  if (n & 1) {
+    if (hi < 0.0) lo = -lo;
+    *t_lo = 0.0;
+    return (cPiD2_1 - fabs(hi)) + (cPiD2_2 - lo);
+  }
+  if (!(hi >= 0.0)) {
+    *neg ^= 1;
+    hi = -hi;
+    lo = -lo;
+  }
+  *t_lo = lo;
+  return hi;
+}
+
+double KERNEL(sin_4)(double x) {
+  int neg;
+  double lo;
+  double t = fold_lo(x, &neg, &lo);
+  double t2 = t * t;
+  double t3 = t2 * t;
+  double p = c4[6];
+  for (int i = 5; i >= 0; i--) p = fma(p, t2, c4[i]);
+  p = fma(p, t3, t + lo);
+  return neg ? -p : p;
+}
+
+// sincos3.s
+void KERNEL(sincos_3)(double x, double *s, double *c) {
+  int neg_s = 0;
+  if (!(x >= 0.0)) {
+    neg_s = 1;
+    x = -x;
+  }
+  double hi, lo;
+  int n = reduce_pos(x, &hi, &lo);
+  if (n & 2) neg_s ^= 1;
+  int neg_c = ((n + 1) >> 1) & 1;
+  int neg_r = !(hi >= 0.0);
+  if (neg_r) lo = -lo;
+  double r = fabs(hi);
+  double q = (cPiD2_1 - r) + (cPiD2_2 - lo);
+
+  double pr = fma(a[13], r, a[12]);
+  double pq = fma(a[13], q, a[12]);
+  for (int i = 11; i >= 0; i--) {
+    pr = fma(pr, r, a[i]);
+    pq = fma(pq, q, a[i]);
+  }
+  // Whichever of Sin and Cos gets P(|r|) also takes the sign of r.
+  double vs, vc;
+  if (n & 1) {
+    vs = pq;
+    vc = pr;
+    neg_c ^= neg_r;
+  } else {
+    vs = pr;
+    vc = pq;
+    neg_s ^= neg_r;
+  }
+  *s = neg_s ? -vs : vs;
+  *c = neg_c ? -vc : vc;
+}
+
+// reduce.s, the leading word only
+double KERNEL(reduce)(double x) {
+  if (fabs(x) >= cHuge) {
+    double hi, lo;
+    phReduce(x, &hi, &lo);
+    return hi;
+  }
+  double n = fma(x, c2DPi, cToInt) - cToInt;
+  x = fma(-n, cPiD2_1, x);
+  x = fma(-n, cPiD2_2, x);
+  return fma(-n, cPiD2_3, x);
+}
+
+// sinf3.s
+static const float fs[3] = {
+  -1.666665524e-01f, +8.332160302e-03f, -1.951528247e-04f,
+};
+static const float fc[4] = {
+  -5.000000000e-01f, +4.166661948e-02f, -1.388668199e-03f, +2.438356751e-05f,
+};
+
+static const float c2DPiF = +6.366197467e-01f;
+static const float cToIntF = +12582912.0f;      // 1.5*2^23
+static const float cPiD2_1F = +1.570796371e+00f;
+static const float cPiD2_2F = -4.371138829e-08f;
+static const float cPiD2_3F = -1.715124510e-15f;
+static const float cHugeF = +262144.0f;
+
+float KERNEL(sinf_3)(float x) {
+  int neg = signbit(x) != 0;    // so that sinf_3(-0) = -0
+  x = fabsf(x);
+  float hi, lo;
+  int n;
+  if (x >= cHugeF) {
+    double hd, ld;
+    n = phReduce(x, &hd, &ld);
+    hi = (float)hd;
+    lo = (float)((hd - (double)hi) + ld);
+  } else {
+    float t = fmaf(x, c2DPiF, cToIntF);
+    uint32_t bits;
+    memcpy(&bits, &t, sizeof(bits));
+    n = bits;
+    float m = t - cToIntF;
+    float r = fmaf(-m, cPiD2_1F, x);
+    float p = m * cPiD2_2F;
+    float pe = fmaf(m, cPiD2_2F, -p);
+    float h = r - p;
+    float bb = h - r;
+    float e = (r - (h - bb)) - (p + bb);
+    float l = fmaf(-m, cPiD2_3F, e - pe);
+    hi = h + l;                 // renormalize
+    lo = l - (hi - h);
+  }
+  if (n & 2) neg ^= 1;
+
+  float y;
+  if (n & 1) {                  // Cos(r)
+    float z = hi * hi;
+    float ze = fmaf(hi, hi, -z);
+    float hz = z * 0.5f;
+    float w = 1.0f - hz;
+    float e = ((1.0f - w) - hz) - fmaf(0.5f, ze, lo * hi);
+    float q = fmaf(fmaf(fc[3], z, fc[2]), z, fc[1]);
+    y = w + fmaf(z * z, q, e);
+  } else {                      // Sin(r) = -Sin(-r)
+    if (!(hi >= 0.0f)) {
+      neg ^= 1;
+      hi = -hi;
+      lo = -lo;
+    }
+    float z = hi * hi;
+    float p = fmaf(fmaf(fs[2], z, fs[1]), z, fs[0]);
+    y = hi + fmaf(hi * z, p, lo);
+  }
+  return neg ? -y : y;
+}
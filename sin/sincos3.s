@@ -0,0 +1,180 @@
+// sincos3.s
+// Sin(x) and Cos(x) together, with one reduction
+//
+// void sincos_3(double x, double *s, double *c)
+//
+// With |x| = n*Pi/2 + r, Sin takes quadrant n and Cos quadrant n + 1,
+// so between them they always need both P(|r|) and P(Pi/2 - |r|),
+// where P is sin_3's polynomial.  The two Horner chains are
+// independent and run interleaved; the quadrant says which one is
+// which.  *s is bit for bit sin_3(x).
+
+.global         _sincos_3
+.p2align        2		// Make sure everything is aligned properly
+
+        .macro  LOADVAL reg, name
+        adrp    x0, \name@GOTPAGE
+        ldr     x0, [x0, \name@GOTPAGEOFF]
+        ldr     \reg, [x0]
+        .endm
+
+.text
+
+_sincos_3:
+        mov     x3, x0          // x3 = s, x4 = c, LOADVAL uses x0
+        mov     x4, x1
+        mov     w1, wzr         // w1 bit 0: negate Sin at the end
+
+        fcmp    d0, #0.0
+        bge     pos             // x < 0: Sin(x) = -Sin(-x), Cos(x) = Cos(-x)
+        mov     w1, 0x0001
+        fneg    d0, d0
+
+pos:
+        LOADVAL d1, cHuge       // |x| >= 2^20 goes to Payne-Hanek
+        fcmp    d0, d1
+        bge     huge
+
+        // Cody-Waite reduction, as in sin3.s
+        LOADVAL d1, c2DPi
+        LOADVAL d2, cToInt
+        fmadd   d3, d0, d1, d2  // d3 = x*2/Pi + 1.5*2^52, n is in the low bits
+        fmov    x2, d3
+        fsub    d3, d3, d2      // d3 = n
+        LOADVAL d1, cPiD2_1
+        fmsub   d0, d3, d1, d0  // d0 = x - n*PiD2_1, exact
+        LOADVAL d1, cPiD2_2
+        fmul    d4, d3, d1      // d4 = p = n*PiD2_2
+        fnmsub  d5, d3, d1, d4  // d5 = n*PiD2_2 - p
+        fsub    d6, d0, d4      // d6 = hi = d0 - p
+        fsub    d7, d6, d0      // two-sum error of d0 - p
+        fsub    d16, d6, d7
+        fsub    d16, d0, d16
+        fadd    d17, d4, d7
+        fsub    d16, d16, d17
+        fsub    d16, d16, d5
+        LOADVAL d1, cPiD2_3
+        fmsub   d1, d3, d1, d16 // d1 = lo
+        fmov    d0, d6          // d0 = hi
+        mov     w9, w2
+
+quadrant:                       // w9 = quadrant, d0 + d1 = r, |r| <= Pi/4
+        tst     w9, #2          // Sin is negative in quadrants 2 & 3,
+        beq     cosign
+        eor     w1, w1, 0x0001
+cosign:
+        add     w5, w9, #1      // Cos in quadrants 1 & 2
+        ubfx    w5, w5, #1, #1  // w5 bit 0: negate Cos at the end
+
+        fcmp    d0, #0.0
+        cset    w6, lt          // w6 = r < 0, the sign of P(|r|)
+        fneg    d3, d1
+        fcsel   d3, d3, d1, mi  // d3 = lo of |r|
+        fabs    d2, d0          // d2 = |r|
+        LOADVAL d4, cPiD2_1
+        LOADVAL d5, cPiD2_2
+        fsub    d4, d4, d2
+        fsub    d5, d5, d3
+        fadd    d3, d4, d5      // d3 = Pi/2 - |r|
+
+        LOADVAL d16, a0
+        LOADVAL d17, a1
+        LOADVAL d18, a2
+        LOADVAL d19, a3
+        LOADVAL d20, a4
+        LOADVAL d21, a5
+        LOADVAL d22, a6
+        LOADVAL d23, a7
+        LOADVAL d24, a8
+        LOADVAL d25, a9
+        LOADVAL d26, a10
+        LOADVAL d27, a11
+        LOADVAL d28, a12
+        LOADVAL d29, a13
+
+        fmadd   d6, d29, d2, d28        // d6 = P(|r|)
+        fmadd   d7, d29, d3, d28        // d7 = P(Pi/2 - |r|)
+        fmadd   d6, d6, d2, d27
+        fmadd   d7, d7, d3, d27
+        fmadd   d6, d6, d2, d26
+        fmadd   d7, d7, d3, d26
+        fmadd   d6, d6, d2, d25
+        fmadd   d7, d7, d3, d25
+        fmadd   d6, d6, d2, d24
+        fmadd   d7, d7, d3, d24
+        fmadd   d6, d6, d2, d23
+        fmadd   d7, d7, d3, d23
+        fmadd   d6, d6, d2, d22
+        fmadd   d7, d7, d3, d22
+        fmadd   d6, d6, d2, d21
+        fmadd   d7, d7, d3, d21
+        fmadd   d6, d6, d2, d20
+        fmadd   d7, d7, d3, d20
+        fmadd   d6, d6, d2, d19
+        fmadd   d7, d7, d3, d19
+        fmadd   d6, d6, d2, d18
+        fmadd   d7, d7, d3, d18
+        fmadd   d6, d6, d2, d17
+        fmadd   d7, d7, d3, d17
+        fmadd   d6, d6, d2, d16
+        fmadd   d7, d7, d3, d16
+
+        // Even quadrant: Sin = P(|r|), Cos = P(Pi/2 - |r|); odd: swapped.
+        // Whichever gets P(|r|) also takes the sign of r.
+        tst     w9, #1
+        fcsel   d0, d7, d6, ne
+        fcsel   d1, d6, d7, ne
+        and     w7, w9, #1
+        bic     w8, w6, w7
+        eor     w1, w1, w8
+        and     w7, w6, w7
+        eor     w5, w5, w7
+
+        fneg    d2, d0
+        tst     w1, #1
+        fcsel   d0, d2, d0, ne
+        fneg    d3, d1
+        tst     w5, #1
+        fcsel   d1, d3, d1, ne
+        str     d0, [x3]
+        str     d1, [x4]
+        ret
+
+huge:                           // d0 = |x| >= 2^20, w1 = sign flag
+        stp     x29, x30, [sp, #-64]!
+        mov     x29, sp
+        stp     x3, x4, [sp, #32] // keep the pointers and the flag
+        str     w1, [sp, #48]     //   across the call
+        add     x0, sp, #16     // &hi
+        add     x1, sp, #24     // &lo
+        bl      _phReduce       // w0 = quadrant, |x| = w0*Pi/2 + hi + lo
+        mov     w9, w0
+        ldr     w1, [sp, #48]
+        ldp     x3, x4, [sp, #32]
+        ldp     d0, d1, [sp, #16]
+        ldp     x29, x30, [sp], #64
+        b       quadrant
+
+.p2align        2
+.data
+a0:	.double	+3.15159609307366933583264e-17
+a1:	.double	+9.99999999999992137463981e-1
+a2:	.double	+3.24848403977218879514298e-13
+a3:	.double	-1.66666666671945646405887e-1
+a4:	.double	+4.46929940061919965152147e-11
+a5:	.double	+8.33333310712103651500584e-3
+a6:	.double	+7.39903364746182917886826e-10
+a7:	.double	-1.98414335571346275936300e-4
+a8:	.double	+2.51241790401253696723421e-9
+a9:	.double	+2.75303544969185019022074e-6
+a10:	.double	+2.00650971121911487700779e-9
+a11:	.double	-2.60546344930653900663444e-8
+a12:	.double	+3.11243537080303902068867e-10
+a13:	.double	+1.12392760716968552199773e-10
+
+c2DPi:  .double +6.36619772367581382433e-01     // 2/Pi
+cToInt: .double +6755399441055744.0             // 1.5*2^52
+cPiD2_1: .double +1.57079632679489655800e+00    // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+cPiD2_2: .double +6.12323399573676603587e-17
+cPiD2_3: .double -1.49738490485916983294e-33
+cHuge:  .double +1048576.0
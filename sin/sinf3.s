@@ -0,0 +1,163 @@
+// sinf3.s
+// Approximate Sin(x) in single precision
+//
+// float sinf_3(float x)
+//
+// The same plan as sin3.s with float constants: a Cody-Waite
+// reduction with Pi/2 in three floats, then a polynomial on the
+// remainder.  A float has only 24 bits, so two things change.  The
+// reduction ends with a renormalization, since hi on its own can be
+// short by the rounding of n*PiD2_2; and rather than folding odd
+// quadrants onto [Pi/4, Pi/2], where float evaluation loses about a
+// bit, there are two polynomials on [0, Pi/4]:
+//
+//     Sin(r) ~ r + r^3*(fs0 + fs1*r^2 + fs2*r^4)        rel. error <= 8.3e-9
+//     Cos(r) ~ 1 - r^2/2 + r^4*(fc1 + fc2*r^2 + fc3*r^4)  rel. error <= 3.1e-9
+//
+// The low word of r goes in as a first-order correction.  Cody-Waite
+// holds to within 1 ulp below 2^18; past that the argument goes to
+// phReduce as a double.  Max error 0.92 ulp over all floats.
+
+.global         _sinf_3
+.p2align        2		// Make sure everything is aligned properly
+
+        .macro  LOADVAL reg, name
+        adrp    x0, \name@GOTPAGE
+        ldr     x0, [x0, \name@GOTPAGEOFF]
+        ldr     \reg, [x0]
+        .endm
+
+.text
+
+_sinf_3:
+        mov     w1, wzr         // we're going to use w1 to keep some flags
+
+        fmov    w3, s0
+        tbz     w3, #31, pos    // sign bit set (x < 0 or -0), return -Sin(-x)
+        mov     w1, 0x0001      // 1 in w1 bit 1 will mean negate the result at the end
+        fneg    s0, s0
+
+pos:
+        LOADVAL s1, cHuge       // |x| >= 2^18 goes to Payne-Hanek
+        fcmp    s0, s1
+        bge     huge
+
+        // Cody-Waite reduction, as in sin3.s: x = n*Pi/2 + r, r = s0 + s1
+        LOADVAL s1, c2DPi
+        LOADVAL s2, cToInt
+        fmadd   s3, s0, s1, s2  // s3 = x*2/Pi + 1.5*2^23, n is in the low bits
+        fmov    w2, s3
+        fsub    s3, s3, s2      // s3 = n
+        LOADVAL s1, cPiD2_1
+        fmsub   s0, s3, s1, s0  // s0 = x - n*PiD2_1, exact
+        LOADVAL s1, cPiD2_2
+        fmul    s4, s3, s1      // s4 = p = n*PiD2_2
+        fnmsub  s5, s3, s1, s4  // s5 = n*PiD2_2 - p
+        fsub    s6, s0, s4      // s6 = h = s0 - p
+        fsub    s7, s6, s0      // two-sum error of s0 - p:
+        fsub    s16, s6, s7     //   (s0 - (h - bb)) - (p + bb)
+        fsub    s16, s0, s16
+        fadd    s17, s4, s7
+        fsub    s16, s16, s17
+        fsub    s16, s16, s5
+        LOADVAL s1, cPiD2_3
+        fmsub   s1, s3, s1, s16 // s1 = l
+        fadd    s0, s6, s1      // s0 = hi = h + l
+        fsub    s2, s0, s6
+        fsub    s1, s1, s2      // s1 = lo = l - (hi - h)
+        mov     w0, w2
+
+quadrant:                       // w0 = quadrant, s0 + s1 = r, |r| <= Pi/4
+        tst     w0, #2          // quadrants 2 & 3 are negative
+        beq     parity
+        eor     w1, w1, 0x0001
+parity:
+        tst     w0, #1
+        bne     odd
+        fcmp    s0, #0.0        // even quadrant: Sin(r) = -Sin(-r)
+        bge     sin
+        eor     w1, w1, 0x0001
+        fneg    s0, s0
+        fneg    s1, s1
+
+sin:                            // 0 <= s0 <= Pi/4
+        LOADVAL s16, fs0
+        LOADVAL s17, fs1
+        LOADVAL s18, fs2
+        fmul    s2, s0, s0      // s2 = z = r^2
+        fmadd   s17, s18, s2, s17
+        fmadd   s16, s17, s2, s16
+        fmul    s3, s0, s2      // s3 = r^3
+        fmadd   s1, s3, s16, s1 // r^3*P(z) + lo
+        fadd    s0, s0, s1
+        b       sign
+
+odd:                            // odd quadrant: Cos(r), |s0| <= Pi/4
+        LOADVAL s17, fc1
+        LOADVAL s18, fc2
+        LOADVAL s19, fc3
+        fmul    s2, s0, s0      // s2 = z = r^2
+        fnmsub  s3, s0, s0, s2  // s3 = r^2 - z, exact
+        fmov    s4, #0.5
+        fmul    s5, s2, s4      // s5 = z/2
+        fmov    s6, #1.0
+        fsub    s7, s6, s5      // s7 = w = 1 - z/2
+        fsub    s6, s6, s7      // (1 - w) - z/2, exact but for the rounding of w
+        fsub    s6, s6, s5
+        fmul    s1, s1, s0      // Cos(r + lo) ~ Cos(r) - lo*r
+        fmadd   s1, s4, s3, s1
+        fsub    s6, s6, s1
+        fmadd   s18, s19, s2, s18
+        fmadd   s17, s18, s2, s17
+        fmul    s2, s2, s2      // s2 = r^4
+        fmadd   s6, s2, s17, s6
+        fadd    s0, s7, s6
+
+sign:
+        and     w1, w1, 0x0001
+        cmp     w1, #0
+        beq     end
+        fneg    s0, s0
+
+end:
+        ret
+
+huge:                           // s0 = |x| >= 2^18, w1 = sign flag
+        stp     x29, x30, [sp, #-48]!
+        mov     x29, sp
+        str     w1, [sp, #32]   // keep the flag across the call
+        fcvt    d0, s0
+        add     x0, sp, #16     // &hi
+        add     x1, sp, #24     // &lo
+        bl      _phReduce       // w0 = quadrant, |x| = w0*Pi/2 + hi + lo
+        ldr     w1, [sp, #32]
+        ldp     d0, d1, [sp, #16]
+        ldp     x29, x30, [sp], #48
+        fcvt    s2, d0          // hi to float, and what that leaves over to lo
+        fcvt    d3, s2
+        fsub    d0, d0, d3
+        fadd    d0, d0, d1
+        fcvt    s1, d0
+        fmov    s0, s2
+        b       quadrant
+
+.p2align        2
+.data
+// sinf_3, generated by: remez -d 7 -m 0 -M 0.78539816339744828 -o -f -n sinf_3 -s -l fs
+// relative error <= 8.320e-09
+fs0:	.float	-1.666665524e-01
+fs1:	.float	+8.332160302e-03
+fs2:	.float	-1.951528247e-04
+// cosf_3, generated by: remez -d 8 -m 0 -M 0.78539816339744828 -c -f -n cosf_3 -s -l fc
+// relative error <= 3.085e-09; fc0 = -1/2 is folded into w = 1 - z/2
+fc0:	.float	-5.000000000e-01
+fc1:	.float	+4.166661948e-02
+fc2:	.float	-1.388668199e-03
+fc3:	.float	+2.438356751e-05
+
+c2DPi:  .float  +6.366197467e-01        // 2/Pi
+cToInt: .float  +12582912.0             // 1.5*2^23
+cPiD2_1: .float +1.570796371e+00        // Pi/2 = PiD2_1 + PiD2_2 + PiD2_3
+cPiD2_2: .float -4.371138829e-08
+cPiD2_3: .float -1.715124510e-15
+cHuge:  .float  +262144.0
@@ -0,0 +1,269 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "mysin.h"
+
+// Array version of sinf_3.
+//
+// As in sin_batch.c, each vector kernel follows sinf3.s step for step
+// in every lane, so the results are bit for bit those of the scalar
+// routine.  Both polynomials are evaluated and the quadrant picks one;
+// they share z = r^2, and with 4, 8 or 16 floats to a vector that is
+// cheaper than the branch.  Sin is odd, so it is run on r as it comes
+// and the sign of r is folded into the final negation.  Lanes with
+// |x| >= 2^18 (and infinities) are redone by sinf_3, which goes
+// through Payne-Hanek in double; the tail goes through sinf_3 as well.
+
+static const float fs[3] = {
+  -1.666665524e-01f,
+  +8.332160302e-03f,
+  -1.951528247e-04f
+};
+
+static const float fc[4] = {
+  -5.000000000e-01f,            // folded into w = 1 - z/2
+  +4.166661948e-02f,
+  -1.388668199e-03f,
+  +2.438356751e-05f
+};
+
+static const float c2DPi = 6.366197467e-01f;
+static const float cToInt = 12582912.0f;
+static const float cPiD2_1 = 1.570796371e+00f;
+static const float cPiD2_2 = -4.371138829e-08f;
+static const float cPiD2_3 = -1.715124510e-15f;
+static const float cHuge = 262144.0f;
+
+static void sinf_3_tail(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    y[i] = sinf_3(x[i]);
+  }
+}
+
+// Redo the lanes set in mask with the scalar routine.
+static void sinf_3_lanes(const float *x, float *y, unsigned mask) {
+  for (int k = 0; mask != 0; k++, mask >>= 1) {
+    if (mask & 1) y[k] = sinf_3(x[k]);
+  }
+}
+
+#if defined(__aarch64__)
+#include <arm_neon.h>
+
+void sinf_3_batch_neon(const float *x, float *y, size_t n) {
+  const float32x4_t two_d_pi = vdupq_n_f32(c2DPi);
+  const float32x4_t to_int = vdupq_n_f32(cToInt);
+  const float32x4_t pi_2_1 = vdupq_n_f32(cPiD2_1);
+  const float32x4_t pi_2_2 = vdupq_n_f32(cPiD2_2);
+  const float32x4_t pi_2_3 = vdupq_n_f32(cPiD2_3);
+  const float32x4_t zero = vdupq_n_f32(0.0f);
+  const float32x4_t half = vdupq_n_f32(0.5f);
+  const float32x4_t one_f = vdupq_n_f32(1.0f);
+  const float32x4_t huge_x = vdupq_n_f32(cHuge);
+  const uint32x4_t sign = vdupq_n_u32(0x80000000U);
+  const uint32x4_t one = vdupq_n_u32(1);
+  const uint32x4_t two = vdupq_n_u32(2);
+  const uint32_t lane_bits[4] = {1, 2, 4, 8};
+  const uint32x4_t bits = vld1q_u32(lane_bits);
+  size_t i = 0;
+
+  for (; i + 4 <= n; i += 4) {
+    float32x4_t v = vld1q_f32(x + i);
+
+    // sign bit set (x < 0 or -0): remember to negate, work with -x
+    uint32x4_t neg = vandq_u32(vreinterpretq_u32_f32(v), sign);
+    v = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(v), neg));
+    uint32x4_t huge = vcgeq_f32(v, huge_x);
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo, renormalized
+    float32x4_t t = vfmaq_f32(to_int, v, two_d_pi);
+    uint32x4_t q = vreinterpretq_u32_f32(t);
+    float32x4_t k = vsubq_f32(t, to_int);
+    float32x4_t r = vfmsq_f32(v, k, pi_2_1);
+    float32x4_t p = vmulq_f32(k, pi_2_2);
+    float32x4_t pe = vnegq_f32(vfmsq_f32(p, k, pi_2_2));
+    float32x4_t h = vsubq_f32(r, p);
+    float32x4_t bb = vsubq_f32(h, r);
+    float32x4_t e = vsubq_f32(vsubq_f32(r, vsubq_f32(h, bb)), vaddq_f32(p, bb));
+    float32x4_t l = vfmsq_f32(vsubq_f32(e, pe), k, pi_2_3);
+    float32x4_t hi = vaddq_f32(h, l);
+    float32x4_t lo = vsubq_f32(l, vsubq_f32(hi, h));
+
+    // Quadrants 2 & 3 are negative.  Even quadrants take Sin(r),
+    // odd quadrants Cos(r).
+    neg = veorq_u32(neg, vandq_u32(vtstq_u32(q, two), sign));
+    uint32x4_t odd = vtstq_u32(q, one);
+    uint32x4_t hneg = vbicq_u32(sign, vcgeq_f32(hi, zero));
+    neg = veorq_u32(neg, vbicq_u32(hneg, odd));
+    float32x4_t z = vmulq_f32(hi, hi);
+
+    float32x4_t ps = vfmaq_f32(vdupq_n_f32(fs[1]), vdupq_n_f32(fs[2]), z);
+    ps = vfmaq_f32(vdupq_n_f32(fs[0]), ps, z);
+    float32x4_t ys = vaddq_f32(hi, vfmaq_f32(lo, vmulq_f32(hi, z), ps));
+    ys = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(ys), hneg));
+
+    float32x4_t ze = vnegq_f32(vfmsq_f32(z, hi, hi));
+    float32x4_t hz = vmulq_f32(z, half);
+    float32x4_t w = vsubq_f32(one_f, hz);
+    float32x4_t c = vsubq_f32(vsubq_f32(one_f, w), hz);
+    c = vsubq_f32(c, vfmaq_f32(vmulq_f32(lo, hi), half, ze));
+    float32x4_t pc = vfmaq_f32(vdupq_n_f32(fc[2]), vdupq_n_f32(fc[3]), z);
+    pc = vfmaq_f32(vdupq_n_f32(fc[1]), pc, z);
+    float32x4_t yc = vaddq_f32(w, vfmaq_f32(c, vmulq_f32(z, z), pc));
+
+    float32x4_t y_ = vbslq_f32(odd, yc, ys);
+    y_ = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(y_), neg));
+    vst1q_f32(y + i, y_);
+    unsigned lanes = vaddvq_u32(vandq_u32(huge, bits));
+    if (lanes) sinf_3_lanes(x + i, y + i, lanes);
+  }
+  sinf_3_tail(x + i, y + i, n - i);
+}
+#endif
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+__attribute__((target("avx2,fma")))
+void sinf_3_batch_avx2(const float *x, float *y, size_t n) {
+  const __m256 two_d_pi = _mm256_set1_ps(c2DPi);
+  const __m256 to_int = _mm256_set1_ps(cToInt);
+  const __m256 pi_2_1 = _mm256_set1_ps(cPiD2_1);
+  const __m256 pi_2_2 = _mm256_set1_ps(cPiD2_2);
+  const __m256 pi_2_3 = _mm256_set1_ps(cPiD2_3);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 half = _mm256_set1_ps(0.5f);
+  const __m256 one_f = _mm256_set1_ps(1.0f);
+  const __m256 huge_x = _mm256_set1_ps(cHuge);
+  const __m256 sign = _mm256_set1_ps(-0.0f);
+  size_t i = 0;
+
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_loadu_ps(x + i);
+
+    // sign bit set (x < 0 or -0): remember to negate, work with -x
+    __m256 neg = _mm256_and_ps(v, sign);
+    v = _mm256_xor_ps(v, neg);
+    int huge = _mm256_movemask_ps(_mm256_cmp_ps(v, huge_x, _CMP_GE_OQ));
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo, renormalized
+    __m256 t = _mm256_fmadd_ps(v, two_d_pi, to_int);
+    __m256i q = _mm256_castps_si256(t);
+    __m256 k = _mm256_sub_ps(t, to_int);
+    __m256 r = _mm256_fnmadd_ps(k, pi_2_1, v);
+    __m256 p = _mm256_mul_ps(k, pi_2_2);
+    __m256 pe = _mm256_fmsub_ps(k, pi_2_2, p);
+    __m256 h = _mm256_sub_ps(r, p);
+    __m256 bb = _mm256_sub_ps(h, r);
+    __m256 e = _mm256_sub_ps(_mm256_sub_ps(r, _mm256_sub_ps(h, bb)),
+                             _mm256_add_ps(p, bb));
+    __m256 l = _mm256_fnmadd_ps(k, pi_2_3, _mm256_sub_ps(e, pe));
+    __m256 hi = _mm256_add_ps(h, l);
+    __m256 lo = _mm256_sub_ps(l, _mm256_sub_ps(hi, h));
+
+    // Quadrants 2 & 3 are negative.  Even quadrants take Sin(r), odd
+    // quadrants Cos(r).  Shifting the quadrant bits up to the sign bit
+    // makes them usable as masks.
+    neg = _mm256_xor_ps(neg, _mm256_and_ps(_mm256_castsi256_ps(_mm256_slli_epi32(q, 30)), sign));
+    __m256 odd = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+    __m256 hneg = _mm256_and_ps(_mm256_cmp_ps(hi, zero, _CMP_NGE_UQ), sign);
+    neg = _mm256_xor_ps(neg, _mm256_blendv_ps(hneg, zero, odd));
+    __m256 z = _mm256_mul_ps(hi, hi);
+
+    __m256 ps = _mm256_fmadd_ps(_mm256_set1_ps(fs[2]), z, _mm256_set1_ps(fs[1]));
+    ps = _mm256_fmadd_ps(ps, z, _mm256_set1_ps(fs[0]));
+    __m256 ys = _mm256_add_ps(hi, _mm256_fmadd_ps(_mm256_mul_ps(hi, z), ps, lo));
+    ys = _mm256_xor_ps(ys, hneg);
+
+    __m256 ze = _mm256_fmsub_ps(hi, hi, z);
+    __m256 hz = _mm256_mul_ps(z, half);
+    __m256 w = _mm256_sub_ps(one_f, hz);
+    __m256 c = _mm256_sub_ps(_mm256_sub_ps(one_f, w), hz);
+    c = _mm256_sub_ps(c, _mm256_fmadd_ps(half, ze, _mm256_mul_ps(lo, hi)));
+    __m256 pc = _mm256_fmadd_ps(_mm256_set1_ps(fc[3]), z, _mm256_set1_ps(fc[2]));
+    pc = _mm256_fmadd_ps(pc, z, _mm256_set1_ps(fc[1]));
+    __m256 yc = _mm256_add_ps(w, _mm256_fmadd_ps(_mm256_mul_ps(z, z), pc, c));
+
+    _mm256_storeu_ps(y + i, _mm256_xor_ps(_mm256_blendv_ps(ys, yc, odd), neg));
+    if (huge) sinf_3_lanes(x + i, y + i, huge);
+  }
+  sinf_3_tail(x + i, y + i, n - i);
+}
+
+__attribute__((target("avx512f")))
+void sinf_3_batch_avx512(const float *x, float *y, size_t n) {
+  const __m512 two_d_pi = _mm512_set1_ps(c2DPi);
+  const __m512 to_int = _mm512_set1_ps(cToInt);
+  const __m512 pi_2_1 = _mm512_set1_ps(cPiD2_1);
+  const __m512 pi_2_2 = _mm512_set1_ps(cPiD2_2);
+  const __m512 pi_2_3 = _mm512_set1_ps(cPiD2_3);
+  const __m512 zero = _mm512_setzero_ps();
+  const __m512 half = _mm512_set1_ps(0.5f);
+  const __m512 one_f = _mm512_set1_ps(1.0f);
+  const __m512 huge_x = _mm512_set1_ps(cHuge);
+  const __m512i sign = _mm512_set1_epi32(0x80000000);
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i two = _mm512_set1_epi32(2);
+  size_t i = 0;
+
+  for (; i + 16 <= n; i += 16) {
+    __m512 v = _mm512_loadu_ps(x + i);
+
+    // sign bit set (x < 0 or -0): remember to negate, work with -x
+    __m512i neg = _mm512_and_si512(_mm512_castps_si512(v), sign);
+    v = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(v), neg));
+    __mmask16 huge = _mm512_cmp_ps_mask(v, huge_x, _CMP_GE_OQ);
+
+    // Cody-Waite: x = n*Pi/2 + hi + lo, renormalized
+    __m512 t = _mm512_fmadd_ps(v, two_d_pi, to_int);
+    __m512i q = _mm512_castps_si512(t);
+    __m512 k = _mm512_sub_ps(t, to_int);
+    __m512 r = _mm512_fnmadd_ps(k, pi_2_1, v);
+    __m512 p = _mm512_mul_ps(k, pi_2_2);
+    __m512 pe = _mm512_fmsub_ps(k, pi_2_2, p);
+    __m512 h = _mm512_sub_ps(r, p);
+    __m512 bb = _mm512_sub_ps(h, r);
+    __m512 e = _mm512_sub_ps(_mm512_sub_ps(r, _mm512_sub_ps(h, bb)),
+                             _mm512_add_ps(p, bb));
+    __m512 l = _mm512_fnmadd_ps(k, pi_2_3, _mm512_sub_ps(e, pe));
+    __m512 hi = _mm512_add_ps(h, l);
+    __m512 lo = _mm512_sub_ps(l, _mm512_sub_ps(hi, h));
+
+    // Quadrants 2 & 3 are negative.  Even quadrants take Sin(r),
+    // odd quadrants Cos(r).
+    neg = _mm512_mask_xor_epi32(neg, _mm512_test_epi32_mask(q, two), neg, sign);
+    __mmask16 odd = _mm512_test_epi32_mask(q, one);
+    __mmask16 hneg = _mm512_cmp_ps_mask(hi, zero, _CMP_NGE_UQ);
+    neg = _mm512_mask_xor_epi32(neg, hneg & ~odd, neg, sign);
+    __m512 z = _mm512_mul_ps(hi, hi);
+
+    __m512 ps = _mm512_fmadd_ps(_mm512_set1_ps(fs[2]), z, _mm512_set1_ps(fs[1]));
+    ps = _mm512_fmadd_ps(ps, z, _mm512_set1_ps(fs[0]));
+    __m512 ys = _mm512_add_ps(hi, _mm512_fmadd_ps(_mm512_mul_ps(hi, z), ps, lo));
+    __m512i ybits = _mm512_castps_si512(ys);
+    ys = _mm512_castsi512_ps(_mm512_mask_xor_epi32(ybits, hneg, ybits, sign));
+
+    __m512 ze = _mm512_fmsub_ps(hi, hi, z);
+    __m512 hz = _mm512_mul_ps(z, half);
+    __m512 w = _mm512_sub_ps(one_f, hz);
+    __m512 c = _mm512_sub_ps(_mm512_sub_ps(one_f, w), hz);
+    c = _mm512_sub_ps(c, _mm512_fmadd_ps(half, ze, _mm512_mul_ps(lo, hi)));
+    __m512 pc = _mm512_fmadd_ps(_mm512_set1_ps(fc[3]), z, _mm512_set1_ps(fc[2]));
+    pc = _mm512_fmadd_ps(pc, z, _mm512_set1_ps(fc[1]));
+    __m512 yc = _mm512_add_ps(w, _mm512_fmadd_ps(_mm512_mul_ps(z, z), pc, c));
+
+    __m512 y_ = _mm512_mask_mov_ps(ys, odd, yc);
+    y_ = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(y_), neg));
+    _mm512_storeu_ps(y + i, y_);
+    if (huge) sinf_3_lanes(x + i, y + i, huge);
+  }
+  sinf_3_tail(x + i, y + i, n - i);
+}
+#endif
+
+// One element at a time, where there is no vector unit to use.
+// dispatch.c binds sinf_3_batch to one of these.
+
+void sinf_3_batch_scalar(const float *x, float *y, size_t n) {
+  sinf_3_tail(x, y, n);
+}
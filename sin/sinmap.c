@@ -0,0 +1,281 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <time.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "mysin.h"
+#include "functions.h"
+
+char* help_string =
+  "sinmap - Sin of every number in a binary file.\n"
+  "usage: sinmap [-h]\n"
+  "       sinmap [-A fname] [-j threads] [-B mib] [-v] [input [output]]\n\n"
+  "    -A fname            Function, as in benchmark -L.  Default sin3\n"
+  "    -j threads          Worker threads.  Default one per CPU.\n"
+  "    -B mib              Block size in MiB when streaming.  Default 16\n"
+  "    -v                  Print the count, time and rate on stderr.\n"
+  "    -h                  Display this help.\n\n"
+  "The input is raw numbers in the machine's byte order: doubles, or\n"
+  "floats for the single precision functions (sinf3, sinf).  The output\n"
+  "is the same count of the same type.  input and output default to\n"
+  "stdin and stdout, and - stands for either.\n\n"
+  "When both are files they are memory-mapped and the threads write the\n"
+  "results straight into the output; otherwise the data goes through in\n"
+  "blocks, each shared among the threads.  Batch entry points are used\n"
+  "where the function has one.\n";
+
+#define CHUNK (1 << 16)         // numbers a thread takes at a time
+
+struct job {
+  struct function_item *f;
+  int           single;
+  const char   *in;
+  char         *out;
+  size_t        n;
+  _Atomic size_t next;          // first number not yet taken
+};
+
+static void *map_chunks(void *arg) {
+  struct job *job = arg;
+  struct function_item *f = job->f;
+  size_t size = job->single ? sizeof(float) : sizeof(double);
+
+  for (;;) {
+    size_t i0 = atomic_fetch_add(&job->next, CHUNK);
+    if (i0 >= job->n) break;
+    size_t n = job->n - i0 < CHUNK ? job->n - i0 : CHUNK;
+    const void *x = job->in + i0 * size;
+    void *y = job->out + i0 * size;
+
+    if (job->single) {
+      const float *xf = x;
+      float *yf = y;
+      if (f->fbatch_ptr != NULL) {
+        f->fbatch_ptr(xf, yf, n);
+      } else {
+        for (size_t i = 0; i < n; i++) yf[i] = f->ff_ptr(xf[i]);
+      }
+    } else {
+      const double *xd = x;
+      double *yd = y;
+      if (f->batch_ptr != NULL) {
+        f->batch_ptr(xd, yd, n);
+      } else {
+        for (size_t i = 0; i < n; i++) yd[i] = f->f_ptr(xd[i]);
+      }
+    }
+  }
+  return NULL;
+}
+
+// job->out[i] = f(job->in[i]) for i < job->n, on up to nthreads threads.
+static void map_function(struct job *job, int nthreads) {
+  size_t chunks = (job->n + CHUNK - 1) / CHUNK;
+  if ((size_t)nthreads > chunks) nthreads = chunks;
+  atomic_store(&job->next, 0);
+  if (nthreads <= 1) {
+    map_chunks(job);
+    return;
+  }
+  pthread_t tid[nthreads];
+  for (int t = 0; t < nthreads; t++) {
+    pthread_create(&tid[t], NULL, map_chunks, job);
+  }
+  for (int t = 0; t < nthreads; t++) {
+    pthread_join(tid[t], NULL);
+  }
+}
+
+// read() and write() until all of len is done, or end of file for read.
+static size_t read_full(int fd, char *buf, size_t len) {
+  size_t done = 0;
+  while (done < len) {
+    ssize_t r = read(fd, buf + done, len - done);
+    if (r < 0) {
+      perror("read");
+      exit(1);
+    }
+    if (r == 0) break;
+    done += r;
+  }
+  return done;
+}
+
+static void write_full(int fd, const char *buf, size_t len) {
+  while (len > 0) {
+    ssize_t w = write(fd, buf, len);
+    if (w < 0) {
+      perror("write");
+      exit(1);
+    }
+    buf += w;
+    len -= w;
+  }
+}
+
+int main(int argc, char **argv) {
+  const char *name = "sin3";
+  int nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  size_t block = 16 << 20;
+  int verbose = 0;
+
+  int c;
+  while ((c = getopt(argc, argv, "A:j:B:vh")) != -1) {
+    switch (c) {
+    case 'A':
+      name = optarg;
+      break;
+    case 'j':
+      nthreads = atoi(optarg);
+      break;
+    case 'B':
+      block = (size_t)(atof(optarg) * (1 << 20));
+      break;
+    case 'v':
+      verbose = 1;
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(1);
+    }
+  }
+  if (nthreads < 1) nthreads = 1;
+  if (optind + 2 < argc) {
+    fprintf(stderr, "%s\n", help_string);
+    exit(1);
+  }
+  const char *in_path = optind < argc && strcmp(argv[optind], "-") != 0 ? argv[optind] : NULL;
+  const char *out_path = optind + 1 < argc && strcmp(argv[optind + 1], "-") != 0 ? argv[optind + 1] : NULL;
+
+  struct function_item f = {name};
+  if (!find_function(&f)) {
+    fprintf(stderr, "Unable to find function: %s\n", name);
+    exit(1);
+  }
+  int single = f.ff_ptr != NULL;
+  size_t size = single ? sizeof(float) : sizeof(double);
+  block -= block % size;
+  if (block < CHUNK * size) block = CHUNK * size;
+
+  int in_fd = 0;
+  if (in_path != NULL && (in_fd = open(in_path, O_RDONLY)) < 0) {
+    perror(in_path);
+    exit(1);
+  }
+  struct stat in_st;
+  if (fstat(in_fd, &in_st) != 0) {
+    perror("input");
+    exit(1);
+  }
+  int out_fd = 1;
+  if (out_path != NULL) {
+    struct stat out_st;
+    if (stat(out_path, &out_st) == 0 && out_st.st_dev == in_st.st_dev &&
+        out_st.st_ino == in_st.st_ino) {
+      fprintf(stderr, "The output can't be the input file.\n");
+      exit(1);
+    }
+    if ((out_fd = open(out_path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0) {
+      perror(out_path);
+      exit(1);
+    }
+  }
+
+  // A regular input file is mapped whole, and if the output is a file
+  // too it is sized to match and mapped as well.
+  const char *in_map = NULL;
+  char *out_map = NULL;
+  size_t bytes = 0;
+  if (S_ISREG(in_st.st_mode)) {
+    bytes = in_st.st_size;
+    if (bytes % size != 0) {
+      fprintf(stderr, "The input isn't a whole number of %ss.\n", single ? "float" : "double");
+      exit(1);
+    }
+    if (bytes > 0) {
+      in_map = mmap(NULL, bytes, PROT_READ, MAP_PRIVATE, in_fd, 0);
+      if (in_map == MAP_FAILED) {
+        perror("mmap input");
+        exit(1);
+      }
+      madvise((void *)in_map, bytes, MADV_SEQUENTIAL);
+    }
+    if (out_path != NULL && bytes > 0) {
+      if (ftruncate(out_fd, bytes) != 0) {
+        perror(out_path);
+        exit(1);
+      }
+      out_map = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, out_fd, 0);
+      if (out_map == MAP_FAILED) {
+        perror("mmap output");
+        exit(1);
+      }
+      madvise(out_map, bytes, MADV_SEQUENTIAL);
+    }
+  }
+
+  struct timespec start, end;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  size_t total = 0;
+  if (out_map != NULL) {
+    struct job job = {&f, single, in_map, out_map, bytes / size};
+    map_function(&job, nthreads);
+    total = bytes;
+    if (munmap(out_map, bytes) != 0) {
+      perror(out_path);
+      exit(1);
+    }
+  } else {
+    char *in_buf = in_map == NULL ? malloc(block) : NULL;
+    char *out_buf = malloc(block);
+    if ((in_map == NULL && in_buf == NULL) || out_buf == NULL) {
+      fprintf(stderr, "Unable to allocate memory.\n");
+      exit(1);
+    }
+    for (;;) {
+      size_t len;
+      const char *src;
+      if (in_map != NULL) {
+        len = bytes - total < block ? bytes - total : block;
+        src = in_map + total;
+      } else {
+        len = read_full(in_fd, in_buf, block);
+        src = in_buf;
+        if (len % size != 0) {
+          fprintf(stderr, "The input isn't a whole number of %ss.\n", single ? "float" : "double");
+          exit(1);
+        }
+      }
+      if (len == 0) break;
+      struct job job = {&f, single, src, out_buf, len / size};
+      map_function(&job, nthreads);
+      write_full(out_fd, out_buf, len);
+      total += len;
+    }
+    free(in_buf);
+    free(out_buf);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  if (in_map != NULL) munmap((void *)in_map, bytes);
+  if (out_path != NULL && close(out_fd) != 0) {
+    perror(out_path);
+    exit(1);
+  }
+
+  if (verbose) {
+    double s = (end.tv_sec - start.tv_sec) + 1e-9 * (end.tv_nsec - start.tv_nsec);
+    fprintf(stderr, "%s: %zu %ss, %.3f s, %.1f MB/s in, %s\n", f.f_name, total / size,
+            single ? "float" : "double", s, total / s / 1e6,
+            out_map != NULL ? "mapped" : "streamed");
+  }
+  return 0;
+}
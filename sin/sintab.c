@@ -0,0 +1,87 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "dd.h"
+
+char* help_string =
+  "sintab - Sin and Cos tables for the table-driven kernel sin_5.\n"
+  "usage: sintab [-h]\n"
+  "       sintab [-n nodes]...\n\n"
+  "    -n nodes            Number of intervals N on [0, Pi/4], a power of two\n"
+  "                        from 64 to 1024.  The table holds the N+1 nodes\n"
+  "                        k*Pi/(4N).  May be repeated, one table each.\n"
+  "                        Default 64, 128 and 256.\n"
+  "    -h                  Display this help.\n";
+
+// Each node k*Pi/(4N) is formed in double-double (k/(4N) is a power of
+// two fraction, so the only rounding is in dd_pi) and its Sin and Cos
+// come from dd_sincos_taylor.  The tables are written as hi + lo
+// pairs, 32 bytes a node, aligned so that a node never straddles a
+// cache line.
+
+#define MAX_TABLES 8
+
+static void print_table(FILE *out, int nodes) {
+  fprintf(out, "static const struct sintab_entry sintab_%d[%d]\n", nodes, nodes + 1);
+  fprintf(out, "  __attribute__((aligned(64))) = {\n");
+  for (int k = 0; k <= nodes; k++) {
+    dd x = dd_mul_d(dd_pi, (double)k / (4.0 * nodes));
+    dd s, c;
+    dd_sincos_taylor(x, &s, &c);
+    fprintf(out, "  {%+.17e, %+.17e, %+.17e, %+.17e}%s\n",
+            s.hi, s.lo, c.hi, c.lo, k < nodes ? "," : "");
+  }
+  fprintf(out, "};\n\n");
+}
+
+int main(int argc, char **argv) {
+  int nodes[MAX_TABLES];
+  int tables = 0;
+
+  int c;
+  while ((c = getopt(argc, argv, "n:h")) != -1) {
+    switch (c) {
+    case 'n':
+      if (tables == MAX_TABLES) {
+        fprintf(stderr, "At most %d tables.\n", MAX_TABLES);
+        exit(1);
+      }
+      nodes[tables] = atoi(optarg);
+      if (nodes[tables] < 64 || nodes[tables] > 1024 ||
+          (nodes[tables] & (nodes[tables] - 1)) != 0) {
+        fprintf(stderr, "Please specify a power of two from 64 to 1024 nodes.\n");
+        exit(1);
+      }
+      tables++;
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(1);
+    }
+  }
+  if (tables == 0) {
+    nodes[tables++] = 64;
+    nodes[tables++] = 128;
+    nodes[tables++] = 256;
+  }
+
+  printf("// sintab.h\n");
+  printf("// Generated by:\n//\tsintab");
+  for (int i = 0; i < tables; i++) printf(" -n %d", nodes[i]);
+  printf("\n//\n");
+  printf("// Sin and Cos at the nodes k*Pi/(4N), k = 0..N, each as a hi + lo\n");
+  printf("// pair of doubles: sn + ssn = Sin, cs + ccs = Cos.\n\n");
+  printf("#ifndef SINTAB_H\n#define SINTAB_H\n\n");
+  printf("struct sintab_entry {\n  double sn, ssn, cs, ccs;\n};\n\n");
+  for (int i = 0; i < tables; i++) {
+    print_table(stdout, nodes[i]);
+  }
+  printf("#endif\n");
+  return 0;
+}
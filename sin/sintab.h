@@ -0,0 +1,478 @@
+// sintab.h
+// Generated by:
+//	sintab -n 64 -n 128 -n 256
+//
+// Sin and Cos at the nodes k*Pi/(4N), k = 0..N, each as a hi + lo
+// pair of doubles: sn + ssn = Sin, cs + ccs = Cos.
+
+#ifndef SINTAB_H
+#define SINTAB_H
+
+struct sintab_entry {
+  double sn, ssn, cs, ccs;
+};
+
+static const struct sintab_entry sintab_64[65]
+  __attribute__((aligned(64))) = {
+  {+0.00000000000000000e+00, +0.00000000000000000e+00, +1.00000000000000000e+00, +0.00000000000000000e+00},
+  {+1.22715382857199254e-02, +6.91979076402831699e-19, +9.99924701839144503e-01, +3.79310825126680184e-17},
+  {+2.45412285229122881e-02, -9.18684901257788901e-20, +9.99698818696204250e-01, -2.98514864037997529e-17},
+  {+3.68072229413588317e-02, +6.10600888035298997e-19, +9.99322384588349544e-01, -4.28585384408456820e-17},
+  {+4.90676743274180149e-02, -6.79610372051827626e-19, +9.98795456205172405e-01, -1.22916933370754648e-17},
+  {+6.13207363022085783e-02, -5.11811340646380884e-19, +9.98118112900149179e-01, +2.79354875581138388e-17},
+  {+7.35645635996674263e-02, -2.77849415062735971e-18, +9.97290456678690207e-01, +9.16476953711017192e-18},
+  {+8.57973123444398938e-02, -3.38818938306840327e-18, +9.96312612182778001e-01, +1.13364978916247288e-17},
+  {+9.80171403295606036e-02, -1.63458236224425579e-18, +9.95184726672196929e-01, -4.24869136783044158e-17},
+  {+1.10222207293883059e-01, -5.67895035378233577e-19, +9.93906970002356061e-01, -1.89648494711237457e-17},
+  {+1.22410675199216196e-01, +2.83545014899653430e-18, +9.92479534598709967e-01, +3.10930550954289061e-17},
+  {+1.34580708507126195e-01, -9.16703591714806995e-18, +9.90902635427780010e-01, +1.53945650945667008e-17},
+  {+1.46730474455361748e-01, +3.72694714704656544e-18, +9.89176509964781014e-01, -4.09873099370471175e-17},
+  {+1.58858143333861446e-01, -4.01632005738590709e-18, +9.87301418157858435e-01, -5.23322612557156463e-17},
+  {+1.70961888760301217e-01, +9.19199801817590790e-18, +9.85277642388941222e-01, +2.31556370279002067e-17},
+  {+1.83039887955140951e-01, +7.73499186886373835e-18, +9.83105487431216285e-01, +4.21700075228886281e-17},
+  {+1.95090322016128276e-01, -7.99107906846173280e-18, +9.80785280403230431e-01, +1.85469399978250088e-17},
+  {+2.07111376192218560e-01, -1.06133625289713558e-17, +9.78317370719627655e-01, -2.16230822333448983e-17},
+  {+2.19101240156869798e-01, -3.65138122991505880e-19, +9.75702130038528570e-01, -2.55725560812596949e-17},
+  {+2.31058108280671110e-01, +1.01297871497618686e-17, +9.72939952205560177e-01, -3.13112111222817999e-17},
+  {+2.42980179903263899e-01, -8.75143152971966624e-18, +9.70031253194543974e-01, +1.83653003484288413e-17},
+  {+2.54865659604514572e-01, -1.36022998069016972e-19, +9.66976471044852071e-01, +3.84962288373378703e-17},
+  {+2.66712757474898365e-01, +2.09412225788266823e-17, +9.63776065795439840e-01, +2.64639505612200319e-17},
+  {+2.78519689385053115e-01, -1.00302737195435424e-17, +9.60430519415565787e-01, +2.46539048153171913e-17},
+  {+2.90284677254462387e-01, -1.89279787077742484e-17, +9.56940335732208824e-01, +4.05538698618757067e-17},
+  {+3.02005949319228084e-01, -1.71676662352624712e-17, +9.53306040354193862e-01, -2.51907387799199336e-17},
+  {+3.13681740398891462e-01, +1.45604472999689122e-17, +9.49528180593036675e-01, -7.55441519280433292e-18},
+  {+3.25310292162262926e-01, +7.91712494637658309e-18, +9.45607325380521280e-01, +4.60191024785237440e-17},
+  {+3.36889853392220051e-01, -4.20009400334747649e-19, +9.41544065183020806e-01, -2.78963795476983349e-17},
+  {+3.48418680249434565e-01, +3.69744205142049254e-18, +9.37339011912574960e-01, -3.65709262843627702e-17},
+  {+3.59895036534988166e-01, -1.76016871238392733e-17, +9.32992798834738846e-01, +4.20414155553843615e-17},
+  {+3.71317193951837543e-01, +3.47492396482386219e-19, +9.28506080473215589e-01, -2.33066398484859367e-17},
+  {+3.82683432365089782e-01, -1.00507726964615830e-17, +9.23879532511286738e-01, +1.76450470843366863e-17},
+  {+3.93992040061048099e-01, +9.76492416412393052e-18, +9.19113851690057770e-01, -2.64964846223447057e-17},
+  {+4.05241314004989861e-01, +9.91114019428998842e-18, +9.14209755703530691e-01, -3.63161825278144292e-17},
+  {+4.16429560097637208e-01, -2.54755804131317323e-17, +9.09167983090522380e-01, -3.68785640913599869e-18},
+  {+4.27555093430282085e-01, +9.41118981629547262e-18, +9.03989293123443338e-01, -6.60975446874843547e-18},
+  {+4.38616238538527659e-01, -2.08833158310750902e-17, +8.98674465693953817e-01, +2.63169064610330166e-17},
+  {+4.49611329654606595e-01, +4.88319242320352512e-18, +8.93224301195515324e-01, -4.11612391519088434e-18},
+  {+4.60538710958240005e-01, +1.84887774921778687e-17, +8.87639620402853935e-01, +1.28050919185879774e-17},
+  {+4.71396736825997642e-01, +6.51667813606902067e-18, +8.81921264348355050e-01, -1.98432484058905437e-17},
+  {+4.82183772079122774e-01, -2.58615009255204481e-17, +8.76070094195406601e-01, +5.87290242351476460e-18},
+  {+4.92898192229784038e-01, -1.02578316765622125e-18, +8.70086991108711461e-01, -4.18885108685499559e-17},
+  {+5.03538383725717575e-01, -1.67313082049675031e-17, +8.63972856121586696e-01, +4.14863559573616133e-17},
+  {+5.14102744193221772e-01, -4.57127075236156486e-17, +8.57728610000272118e-01, -4.81834479363366201e-17},
+  {+5.24589682678468949e-01, -4.30688690400823386e-17, +8.51355193105265196e-01, -5.32798744460161902e-17},
+  {+5.34997619887097264e-01, -5.36831327083581525e-17, +8.44853565249707117e-01, -4.36313602968796433e-17},
+  {+5.45324988422046464e-01, -4.15178175383842701e-17, +8.38224705554838079e-01, -3.55600850528550076e-17},
+  {+5.55570233019602178e-01, +4.70941094056167621e-17, +8.31469612302545236e-01, +1.40738569847280701e-18},
+  {+5.65731810783613231e-01, -3.40960795965904665e-17, +8.24589302785025291e-01, -2.65123604888682721e-17},
+  {+5.75808191417845339e-01, -3.79094954589427465e-17, +8.17584813151583711e-01, -1.48831498124267687e-17},
+  {+5.85797857456438864e-01, -3.74855019643113167e-18, +8.10457198252594768e-01, +2.35203673498404867e-17},
+  {+5.95699304492433357e-01, -1.34386419365794719e-17, +8.03207531480644943e-01, -3.30606098048149219e-17},
+  {+6.05511041404325545e-01, -3.12026724933056708e-17, +7.95836904608883566e-01, -3.00627248519107149e-17},
+  {+6.15231590580626819e-01, +2.62314177672669533e-17, +7.88346427626606228e-01, +3.43969931540597076e-17},
+  {+6.24859488142386343e-01, +3.36718460372438880e-17, +7.80737228572094488e-01, -9.91987820666788214e-18},
+  {+6.34393284163645488e-01, +1.04209019292800392e-17, +7.73010453362736993e-01, -3.25659070336497662e-17},
+  {+6.43831542889791497e-01, -3.20847987950468858e-17, +7.65167265622458959e-01, -3.27072256125345983e-17},
+  {+6.53172842953776756e-01, +8.56956420600262688e-18, +7.57208846506484567e-01, -1.99090987773354988e-17},
+  {+6.62415777590171784e-01, -2.26155088857646007e-17, +7.49136394523459370e-01, -4.47290784470118948e-17},
+  {+6.71558954847018441e-01, -4.04890377492966801e-17, +7.40951125354959106e-01, -1.47086169522973513e-17},
+  {+6.80600997795453022e-01, +2.84732933545220469e-17, +7.32654271672412816e-01, +1.89186734815734980e-17},
+  {+6.89540544737066941e-01, -1.58893232948067837e-17, +7.24247082951466892e-01, +2.91984713344030044e-17},
+  {+6.98376249408972805e-01, +4.89882824356677615e-17, +7.15730825283818706e-01, -5.15810184764102558e-17},
+  {+7.07106781186547573e-01, -4.83364665672645611e-17, +7.07106781186547573e-01, -4.83364665672645611e-17}
+};
+
+static const struct sintab_entry sintab_128[129]
+  __attribute__((aligned(64))) = {
+  {+0.00000000000000000e+00, +0.00000000000000000e+00, +1.00000000000000000e+00, +0.00000000000000000e+00},
+  {+6.13588464915447527e-03, +9.05452574824749205e-20, +9.99981175282601109e-01, +3.35681035228955784e-17},
+  {+1.22715382857199254e-02, +6.91979076402831699e-19, +9.99924701839144503e-01, +3.79310825126680184e-17},
+  {+1.84067299058048202e-02, +7.41955338128331604e-19, +9.99830581795823403e-01, +1.88251405175511193e-17},
+  {+2.45412285229122881e-02, -9.18684901257788901e-20, +9.99698818696204250e-01, -2.98514864037997529e-17},
+  {+3.06748031766366260e-02, -1.69360548441075963e-20, +9.99529417501093143e-01, +2.05179178237555975e-17},
+  {+3.68072229413588317e-02, +6.10600888035298997e-19, +9.99322384588349544e-01, -4.28585384408456820e-17},
+  {+4.29382569349408202e-02, +2.83519405886609110e-18, +9.99077727752645361e-01, +2.14190076535870320e-17},
+  {+4.90676743274180149e-02, -6.79610372051827626e-19, +9.98795456205172405e-01, -1.22916933370754648e-17},
+  {+5.51952443496899411e-02, -1.33402998608911026e-18, +9.98475580573294774e-01, -2.20029311827787980e-17},
+  {+6.13207363022085783e-02, -5.11811340646380884e-19, +9.98118112900149179e-01, +2.79354875581138388e-17},
+  {+6.74439195636640648e-02, -6.92217965569836436e-18, +9.97723066644191636e-01, -2.63944752748987114e-17},
+  {+7.35645635996674263e-02, -2.77849415062735971e-18, +9.97290456678690207e-01, +9.16476953711017192e-18},
+  {+7.96824379714301256e-02, -4.48676643113730408e-18, +9.96820299291165668e-01, +4.70628207086156612e-17},
+  {+8.57973123444398938e-02, -3.38818938306840327e-18, +9.96312612182778001e-01, +1.13364978916247288e-17},
+  {+9.19089564971327239e-02, +4.76315948542745718e-18, +9.95767414467659817e-01, -2.31519083230943588e-17},
+  {+9.80171403295606036e-02, -1.63458236224425579e-18, +9.95184726672196929e-01, -4.24869136783044158e-17},
+  {+1.04121633872054573e-01, +6.57602540853851002e-18, +9.94564570734255415e-01, +3.67450696415280641e-17},
+  {+1.10222207293883059e-01, -5.67895035378233577e-19, +9.93906970002356061e-01, -1.89648494711237457e-17},
+  {+1.16318630911904766e-01, +1.02949148775096990e-18, +9.93211949234794500e-01, +3.30969062612722741e-17},
+  {+1.22410675199216196e-01, +2.83545014899653430e-18, +9.92479534598709967e-01, +3.10930550954289061e-17},
+  {+1.28498110793793169e-01, +3.81986039549888022e-18, +9.91709753669099525e-01, -2.33728913118836881e-18},
+  {+1.34580708507126195e-01, -9.16703591714806995e-18, +9.90902635427780010e-01, +1.53945650945667008e-17},
+  {+1.40658239332849239e-01, -7.91939329655247105e-18, +9.90058210262297123e-01, -1.70554859062339473e-17},
+  {+1.46730474455361748e-01, +3.72694714704656544e-18, +9.89176509964781014e-01, -4.09873099370471175e-17},
+  {+1.52797185258443435e-01, -7.63135739384168224e-18, +9.88257567730749464e-01, +2.70306077843726284e-17},
+  {+1.58858143333861446e-01, -4.01632005738590709e-18, +9.87301418157858435e-01, -5.23322612557156463e-17},
+  {+1.64913120489969922e-01, -7.04052883191667768e-19, +9.86308097244598669e-01, -2.15208771030133409e-17},
+  {+1.70961888760301217e-01, +9.19199801817590790e-18, +9.85277642388941222e-01, +2.31556370279002067e-17},
+  {+1.77004220412148749e-01, +6.73293006354081440e-18, +9.84210092386929025e-01, +4.79839226270506910e-17},
+  {+1.83039887955140951e-01, +7.73499186886373835e-18, +9.83105487431216285e-01, +4.21700075228886281e-17},
+  {+1.89068664149806220e-01, -7.62089558035277622e-18, +9.81963869109555243e-01, +2.11084437115130872e-17},
+  {+1.95090322016128276e-01, -7.99107906846173280e-18, +9.80785280403230431e-01, +1.85469399978250088e-17},
+  {+2.01104634842091901e-01, +1.10100326693007386e-17, +9.79569765685440519e-01, +1.55739915849904202e-17},
+  {+2.07111376192218560e-01, -1.06133625289713558e-17, +9.78317370719627655e-01, -2.16230822333448983e-17},
+  {+2.13110319916091362e-01, +1.20318738210638613e-17, +9.77028142657754395e-01, -4.33538757515559904e-17},
+  {+2.19101240156869798e-01, -3.65138122991505880e-19, +9.75702130038528570e-01, -2.55725560812596949e-17},
+  {+2.25083911359792832e-01, +3.95070408225565255e-18, +9.74339382785575858e-01, +2.30412214761515275e-18},
+  {+2.31058108280671110e-01, +1.01297871497618686e-17, +9.72939952205560177e-01, -3.13112111222817999e-17},
+  {+2.37023605994367198e-01, +8.85448522850399026e-18, +9.71503890986251784e-01, -7.98654211222890920e-18},
+  {+2.42980179903263899e-01, -8.75143152971966624e-18, +9.70031253194543974e-01, +1.83653003484288413e-17},
+  {+2.48927605745720176e-01, -8.17834361000209898e-18, +9.68522094274417267e-01, +4.94750749182447894e-17},
+  {+2.54865659604514572e-01, -1.36022998069016972e-19, +9.66976471044852071e-01, +3.84962288373378703e-17},
+  {+2.60794117915275514e-01, +4.27214209835500826e-18, +9.65394441697689398e-01, -2.37453899183921532e-17},
+  {+2.66712757474898365e-01, +2.09412225788266823e-17, +9.63776065795439840e-01, +2.64639505612200319e-17},
+  {+2.72621355449948977e-01, +7.86971660763878500e-18, +9.62121404269041580e-01, +1.52367704538462924e-17},
+  {+2.78519689385053115e-01, -1.00302737195435424e-17, +9.60430519415565787e-01, +2.46539048153171913e-17},
+  {+2.84407537211271821e-01, +2.22092685106614784e-17, +9.58703474895871599e-01, -4.36850143923720533e-17},
+  {+2.90284677254462387e-01, -1.89279787077742484e-17, +9.56940335732208824e-01, +4.05538698618757067e-17},
+  {+2.96150888243623844e-01, -2.02207363608769288e-17, +9.55141168305770671e-01, +5.00886529550146743e-17},
+  {+3.02005949319228084e-01, -1.71676662352624712e-17, +9.53306040354193862e-01, -2.51907387799199336e-17},
+  {+3.07849640041534867e-01, +2.70740885272451850e-17, +9.51435020969008338e-01, +3.13505841232666766e-17},
+  {+3.13681740398891462e-01, +1.45604472999689122e-17, +9.49528180593036675e-01, -7.55441519280433292e-18},
+  {+3.19502030816015692e-01, -1.39815624910966233e-17, +9.47585591017741091e-01, +4.34179938521259905e-17},
+  {+3.25310292162262926e-01, +7.91712494637658309e-18, +9.45607325380521280e-01, +4.60191024785237440e-17},
+  {+3.31106305759876429e-01, -2.74694654747786878e-17, +9.43593458161960386e-01, -2.40931278444042141e-17},
+  {+3.36889853392220051e-01, -4.20009400334747649e-19, +9.41544065183020806e-01, -2.78963795476983349e-17},
+  {+3.42660717311994378e-01, +1.92615184493063096e-17, +9.39459223602189919e-01, -7.01528679430986240e-18},
+  {+3.48418680249434565e-01, +3.69744205142049254e-18, +9.37339011912574960e-01, -3.65709262843627702e-17},
+  {+3.54163525420490399e-01, -1.69517633057648571e-17, +9.35183509938947610e-01, -3.26093953024850650e-17},
+  {+3.59895036534988166e-01, -1.76016871238392733e-17, +9.32992798834738846e-01, +4.20414155553843615e-17},
+  {+3.65612997804773854e-01, +1.62178987704575461e-17, +9.30766961078983712e-01, +1.97037751028383325e-17},
+  {+3.71317193951837543e-01, +3.47492396482386219e-19, +9.28506080473215589e-01, -2.33066398484859367e-17},
+  {+3.77007410216418259e-01, -2.72553020419569607e-18, +9.26210242138311379e-01, -3.73037545860990542e-17},
+  {+3.82683432365089782e-01, -1.00507726964615830e-17, +9.23879532511286738e-01, +1.76450470843366863e-17},
+  {+3.88345046698826302e-01, -1.00537705983987123e-17, +9.21514039342041902e-01, +4.16398433906846374e-17},
+  {+3.93992040061048099e-01, +9.76492416412393052e-18, +9.19113851690057770e-01, -2.64964846223447057e-17},
+  {+3.99624199845646844e-01, -1.50654974761893716e-17, +9.16679059921042705e-01, -4.17339786982875676e-17},
+  {+4.05241314004989861e-01, +9.91114019428998842e-18, +9.14209755703530691e-01, -3.63161825278144292e-17},
+  {+4.10843171057903966e-01, -2.42198351903555024e-17, +9.11706032005429878e-01, -2.69132731750341363e-17},
+  {+4.16429560097637208e-01, -2.54755804131317323e-17, +9.09167983090522380e-01, -3.68785640913599869e-18},
+  {+4.22000270799799682e-01, +4.35432669941285352e-18, +9.06595704514915335e-01, +3.05067189554420234e-17},
+  {+4.27555093430282085e-01, +9.41118981629547262e-18, +9.03989293123443338e-01, -6.60975446874843547e-18},
+  {+4.33093818853151957e-01, +1.12242833298475230e-17, +9.01348847046022028e-01, -1.35247893676986727e-17},
+  {+4.38616238538527659e-01, -2.08833158310750902e-17, +8.98674465693953817e-01, +2.63169064610330166e-17},
+  {+4.44122144570429256e-01, -2.42188744221783147e-17, +8.95966249756185107e-01, +4.90250991148118070e-17},
+  {+4.49611329654606595e-01, +4.88319242320352512e-18, +8.93224301195515324e-01, -4.11612391519088434e-18},
+  {+4.55083587126343836e-01, -1.23799067581164736e-17, +8.90448723244757878e-01, +1.17819314590518048e-17},
+  {+4.60538710958240005e-01, +1.84887774921778687e-17, +8.87639620402853935e-01, +1.28050919185879774e-17},
+  {+4.65976495767966181e-01, -3.30235477782351007e-18, +8.84797098430937790e-01, -9.43314696289727978e-18},
+  {+4.71396736825997642e-01, +6.51667813606902067e-18, +8.81921264348355050e-01, -1.98432484058905437e-17},
+  {+4.76799230063322144e-01, -1.02935153383058006e-17, +8.79012226428633525e-01, -4.73568372911180108e-17},
+  {+4.82183772079122774e-01, -2.58615009255204481e-17, +8.76070094195406601e-01, +5.87290242351476460e-18},
+  {+4.87550160148435940e-01, +1.42310909312736532e-17, +8.73094978418290091e-01, +7.84246729901299796e-18},
+  {+4.92898192229784038e-01, -1.02578316765622125e-18, +8.70086991108711461e-01, -4.18885108685499559e-17},
+  {+4.98227666972781869e-01, -1.61263838305408008e-17, +8.67046245515692648e-01, +3.02678595509305128e-18},
+  {+5.03538383725717575e-01, -1.67313082049675031e-17, +8.63972856121586696e-01, +4.14863559573616133e-17},
+  {+5.08830142543106989e-01, +4.78369682680141236e-17, +8.60866938637767309e-01, -3.00500488985736500e-17},
+  {+5.14102744193221772e-01, -4.57127075236156486e-17, +8.57728610000272118e-01, -4.81834479363366201e-17},
+  {+5.19355990165589643e-01, -5.53312481441711574e-17, +8.54557988365400534e-01, -1.29911242363960916e-17},
+  {+5.24589682678468949e-01, -4.30688690400823386e-17, +8.51355193105265196e-01, -5.32798744460161902e-17},
+  {+5.29803624686294716e-01, -4.80678417064823481e-17, +8.48120344803297233e-01, +1.87625634152399841e-17},
+  {+5.34997619887097264e-01, -5.36831327083581525e-17, +8.44853565249707117e-01, -4.36313602968796433e-17},
+  {+5.40171472729892854e-01, +2.70724479659358265e-17, +8.41554977436898444e-01, -3.40954653913215505e-17},
+  {+5.45324988422046464e-01, -4.15178175383842701e-17, +8.38224705554838079e-01, -3.55600850528550076e-17},
+  {+5.50457972936604811e-01, -8.33199030158076940e-18, +8.34862874986380010e-01, +4.60484306091596697e-17},
+  {+5.55570233019602178e-01, +4.70941094056167621e-17, +8.31469612302545236e-01, +1.40738569847280701e-18},
+  {+5.60661576197336031e-01, -7.39564181534761055e-18, +8.28045045257755796e-01, -4.41965932258715260e-17},
+  {+5.65731810783613231e-01, -3.40960795965904665e-17, +8.24589302785025291e-01, -2.65123604888682721e-17},
+  {+5.70780745886967256e-01, +2.45681514555662044e-17, +8.21102514991104648e-01, +3.07151316096976817e-17},
+  {+5.75808191417845339e-01, -3.79094954589427465e-17, +8.17584813151583711e-01, -1.48831498124267687e-17},
+  {+5.80813958095764526e-01, +1.85853385866134173e-17, +8.14036329705948414e-01, -5.21273518770426242e-17},
+  {+5.85797857456438864e-01, -3.74855019643113167e-18, +8.10457198252594768e-01, +2.35203673498404867e-17},
+  {+5.90759701858874275e-01, -4.70135841706595359e-17, +8.06847553543799223e-01, +4.92206037660955396e-17},
+  {+5.95699304492433357e-01, -1.34386419365794719e-17, +8.03207531480644943e-01, -3.30606098048149219e-17},
+  {+6.00616479383868973e-01, -4.63981982294619322e-17, +7.99537269107905013e-01, +2.03567238220054308e-17},
+  {+6.05511041404325545e-01, -3.12026724933056708e-17, +7.95836904608883566e-01, -3.00627248519107149e-17},
+  {+6.10382806276309475e-01, -2.25632656482291749e-17, +7.92106577300212389e-01, -3.70878502023264790e-17},
+  {+6.15231590580626819e-01, +2.62314177672669533e-17, +7.88346427626606228e-01, +3.43969931540597076e-17},
+  {+6.20057211763289207e-01, -2.79834108376811245e-17, +7.84556597155575242e-01, -8.56279654231735373e-18},
+  {+6.24859488142386343e-01, +3.36718460372438880e-17, +7.80737228572094488e-01, -9.91987820666788214e-18},
+  {+6.29638238914926984e-01, +4.11153340496268119e-17, +7.76888465673232442e-01, +7.74186025706728327e-18},
+  {+6.34393284163645488e-01, +1.04209019292800392e-17, +7.73010453362736993e-01, -3.25659070336497662e-17},
+  {+6.39124444863775731e-01, +1.24167963122710412e-17, +7.69103337645579588e-01, +5.15464551845648228e-17},
+  {+6.43831542889791497e-01, -3.20847987950468858e-17, +7.65167265622458959e-01, -3.27072256125345983e-17},
+  {+6.48514401022112441e-01, +3.98702703133867848e-18, +7.61202385484261779e-01, +3.53155108816905509e-17},
+  {+6.53172842953776756e-01, +8.56956420600262688e-18, +7.57208846506484567e-01, -1.99090987773354988e-17},
+  {+6.57806693297078637e-01, +1.95809430584685393e-17, +7.53186799043612520e-01, -3.79377898387365335e-17},
+  {+6.62415777590171784e-01, -2.26155088857646007e-17, +7.49136394523459370e-01, -4.47290784470118948e-17},
+  {+6.66999922303637471e-01, +3.52843649974281718e-17, +7.45057785441465947e-01, +1.50786869118778443e-17},
+  {+6.71558954847018441e-01, -4.04890377492966801e-17, +7.40951125354959106e-01, -1.47086169522973513e-17},
+  {+6.76092703575315923e-01, +3.72569022480494661e-17, +7.36816568877369904e-01, -2.89324681016563196e-17},
+  {+6.80600997795453022e-01, +2.84732933545220469e-17, +7.32654271672412816e-01, +1.89186734815734980e-17},
+  {+6.85083667772700355e-01, +2.59481351946451434e-17, +7.28464390448225196e-01, +1.19246423233708596e-19},
+  {+6.89540544737066941e-01, -1.58893232948067837e-17, +7.24247082951466892e-01, +2.91984713344030044e-17},
+  {+6.93971460889654002e-01, +7.43450769562801986e-18, +7.20002507961381655e-01, -2.56896588544623395e-17},
+  {+6.98376249408972805e-01, +4.89882824356677615e-17, +7.15730825283818706e-01, -5.15810184764102558e-17},
+  {+7.02754744457225300e-01, +2.52782943836298140e-18, +7.11432195745216434e-01, +7.96432986138568280e-18},
+  {+7.07106781186547573e-01, -4.83364665672645611e-17, +7.07106781186547573e-01, -4.83364665672645611e-17}
+};
+
+static const struct sintab_entry sintab_256[257]
+  __attribute__((aligned(64))) = {
+  {+0.00000000000000000e+00, +0.00000000000000000e+00, +1.00000000000000000e+00, +0.00000000000000000e+00},
+  {+3.06795676296597614e-03, +1.26902790854559275e-19, +9.99995293809576191e-01, -1.96680642853221918e-17},
+  {+6.13588464915447527e-03, +9.05452574824749205e-20, +9.99981175282601109e-01, +3.35681035228955784e-17},
+  {+9.20375478205981944e-03, -1.21365916935359434e-19, +9.99957644551963898e-01, -3.15278368666472809e-17},
+  {+1.22715382857199254e-02, +6.91979076402831699e-19, +9.99924701839144503e-01, +3.79310825126680184e-17},
+  {+1.53392062849881019e-02, -8.44625788654016860e-19, +9.99882347454212561e-01, -3.54778148724085322e-17},
+  {+1.84067299058048202e-02, +7.41955338128331604e-19, +9.99830581795823403e-01, +1.88251405175511193e-17},
+  {+2.14740802754695079e-02, -4.54079602076885756e-19, +9.99769405351215279e-01, +4.26811770322890116e-17},
+  {+2.45412285229122881e-02, -9.18684901257788901e-20, +9.99698818696204250e-01, -2.98514864037997529e-17},
+  {+2.76081457789657432e-02, -1.59323588313892673e-18, +9.99618822495178638e-01, -4.11819655214247280e-17},
+  {+3.06748031766366260e-02, -1.69360548441075963e-20, +9.99529417501093143e-01, +2.05179178237555975e-17},
+  {+3.37411718513775868e-02, -2.00960742923683437e-18, +9.99430604555461732e-01, +3.96444977522577981e-17},
+  {+3.68072229413588317e-02, +6.10600888035298997e-19, +9.99322384588349544e-01, -4.28585384408456820e-17},
+  {+3.98729275877398107e-02, +4.66574534811833181e-19, +9.99204758618363886e-01, +9.17963171103856931e-18},
+  {+4.29382569349408202e-02, +2.83519405886609110e-18, +9.99077727752645361e-01, +2.14190076535870320e-17},
+  {+4.60031821309146299e-02, -1.11828139401577840e-18, +9.98941293186856871e-01, -2.06106419100586477e-17},
+  {+4.90676743274180149e-02, -6.79610372051827626e-19, +9.98795456205172405e-01, -1.22916933370754648e-17},
+  {+5.21317046802833237e-02, -2.42436952919537795e-18, +9.98640218180265271e-01, -4.86902543129233145e-17},
+  {+5.51952443496899411e-02, -1.33402998608911026e-18, +9.98475580573294774e-01, -2.20029311827787980e-17},
+  {+5.82582645004357594e-02, +2.32999054960774773e-19, +9.98301544933892893e-01, -5.18694027027922775e-17},
+  {+6.13207363022085783e-02, -5.11811340646380884e-19, +9.98118112900149179e-01, +2.79354875581138388e-17},
+  {+6.43826309298574651e-02, -4.23259970000527130e-18, +9.97925286198595995e-01, +1.71436597788863683e-17},
+  {+6.74439195636640648e-02, -6.92217965569836436e-18, +9.97723066644191636e-01, -2.63944752748987114e-17},
+  {+7.05045733896138699e-02, -6.85527911073428909e-18, +9.97511456140303454e-01, +5.60072059198068754e-18},
+  {+7.35645635996674263e-02, -2.77849415062735971e-18, +9.97290456678690207e-01, +9.16476953711017192e-18},
+  {+7.66238613920314920e-02, +2.32537002879587964e-19, +9.97060070339482962e-01, +1.67340935462419573e-17},
+  {+7.96824379714301256e-02, -4.48676643113730408e-18, +9.96820299291165668e-01, +4.70628207086156612e-17},
+  {+8.27402645493756916e-02, +1.47359835308777561e-18, +9.96571145790554835e-01, +1.17071790883909891e-17},
+  {+8.57973123444398938e-02, -3.38818938306840327e-18, +9.96312612182778001e-01, +1.13364978916247288e-17},
+  {+8.88535525825246003e-02, -3.75017758302906906e-18, +9.96044700901251967e-01, +2.28700317076706856e-17},
+  {+9.19089564971327239e-02, +4.76315948542745718e-18, +9.95767414467659817e-01, -2.31519083230943588e-17},
+  {+9.49634953296390055e-02, -6.58858864004175486e-18, +9.95480755491926939e-01, +3.20846214122265576e-18},
+  {+9.80171403295606036e-02, -1.63458236224425579e-18, +9.95184726672196929e-01, -4.24869136783044158e-17},
+  {+1.01069862754827822e-01, +3.31643257193086517e-18, +9.94879330794805616e-01, +4.21308132849436701e-18},
+  {+1.04121633872054573e-01, +6.57602540853851002e-18, +9.94564570734255415e-01, +3.67450696415280641e-17},
+  {+1.07172424956808843e-01, +6.44240442790262053e-18, +9.94240449453187902e-01, +4.41294234724626735e-17},
+  {+1.10222207293883059e-01, -5.67895035378233577e-19, +9.93906970002356061e-01, -1.89648494711237457e-17},
+  {+1.13270952177564346e-01, +2.71004810121329034e-18, +9.93564135520595304e-01, +2.97523099277974346e-17},
+  {+1.16318630911904766e-01, +1.02949148775096990e-18, +9.93211949234794500e-01, +3.30969062612722741e-17},
+  {+1.19365214810991369e-01, -3.95000893918984978e-18, +9.92850414459865105e-01, -1.40945177336933054e-17},
+  {+1.22410675199216196e-01, +2.83545014899653430e-18, +9.92479534598709967e-01, +3.10930550954289061e-17},
+  {+1.25454983411546234e-01, +4.86867517631482271e-18, +9.92099313142191797e-01, -3.94319261495887908e-17},
+  {+1.28498110793793169e-01, +3.81986039549888022e-18, +9.91709753669099525e-01, -2.33728913118836881e-18},
+  {+1.31540028702883116e-01, -5.00397082622138130e-18, +9.91310859846115444e-01, -2.51921115833721052e-17},
+  {+1.34580708507126195e-01, -9.16703591714806995e-18, +9.90902635427780010e-01, +1.53945650945667008e-17},
+  {+1.37620121586486038e-01, +6.62532558667744895e-18, +9.90485084256457093e-01, -5.54114375537808729e-17},
+  {+1.40658239332849239e-01, -7.91939329655247105e-18, +9.90058210262297123e-01, -1.70554859062339473e-17},
+  {+1.43695033150294443e-01, +1.14727230166186617e-17, +9.89622017463200887e-01, -5.23982179681325303e-17},
+  {+1.46730474455361748e-01, +3.72694714704656544e-18, +9.89176509964781014e-01, -4.09873099370471175e-17},
+  {+1.49764534677321509e-01, +8.08121141312851663e-18, +9.88721691960323779e-01, -1.09762272066561219e-17},
+  {+1.52797185258443435e-01, -7.63135739384168224e-18, +9.88257567730749464e-01, +2.70306077843726284e-17},
+  {+1.55828397654265233e-01, +3.03513071876782208e-18, +9.87784141644572178e-01, -2.36006933971590207e-17},
+  {+1.58858143333861446e-01, -4.01632005738590709e-18, +9.87301418157858435e-01, -5.23322612557156463e-17},
+  {+1.61886393780111826e-01, +1.18505196435735298e-17, +9.86809401814185527e-01, -5.02872143510610688e-17},
+  {+1.64913120489969922e-01, -7.04052883191667768e-19, +9.86308097244598669e-01, -2.15208771030133409e-17},
+  {+1.67938294974731173e-01, +5.42845337215581466e-18, +9.85797509167567476e-01, -5.14394529799530116e-17},
+  {+1.70961888760301217e-01, +9.19199801817590790e-18, +9.85277642388941222e-01, +2.31556370279002067e-17},
+  {+1.73983873387463822e-01, +5.81519946181079053e-18, +9.84748501801904208e-01, +1.05481440618299566e-17},
+  {+1.77004220412148749e-01, +6.73293006354081440e-18, +9.84210092386929025e-01, +4.79839226270506910e-17},
+  {+1.80022901405699515e-01, +7.97018260473921272e-18, +9.83662419211730255e-01, +1.98649482016352519e-17},
+  {+1.83039887955140951e-01, +7.73499186886373835e-18, +9.83105487431216285e-01, +4.21700075228886281e-17},
+  {+1.86055151663446661e-01, -1.25648930076795459e-17, +9.82539302287441241e-01, +1.51495808137772175e-17},
+  {+1.89068664149806220e-01, -7.62089558035277622e-18, +9.81963869109555243e-01, +2.11084437115130872e-17},
+  {+1.92080397049892437e-01, +4.33483439411749112e-18, +9.81379193313754561e-01, +1.34281632603556195e-17},
+  {+1.95090322016128276e-01, -7.99107906846173280e-18, +9.80785280403230431e-01, +1.85469399978250088e-17},
+  {+1.98098410717953588e-01, -1.84344118006894180e-18, +9.80182135968117429e-01, -3.68017869638561524e-17},
+  {+2.01104634842091901e-01, +1.10100326693007386e-17, +9.79569765685440519e-01, +1.55739915849904202e-17},
+  {+2.04108966092816868e-01, +6.09412977739577212e-18, +9.78948175319062197e-01, -2.38177279611480375e-18},
+  {+2.07111376192218560e-01, -1.06133625289713558e-17, +9.78317370719627655e-01, -2.16230822333448983e-17},
+  {+2.10111836880469610e-01, +1.15615484765128436e-17, +9.77677357824509929e-01, +5.05141361670596154e-17},
+  {+2.13110319916091362e-01, +1.20318738210638613e-17, +9.77028142657754395e-01, -4.33538757515559904e-17},
+  {+2.16106797076219520e-01, -1.01111960826091144e-17, +9.76369731330021140e-01, +9.30939315262137644e-18},
+  {+2.19101240156869798e-01, -3.65138122991505880e-19, +9.75702130038528570e-01, -2.55725560812596949e-17},
+  {+2.22093620973203537e-01, -3.03372109958121661e-18, +9.75025345066994120e-01, +2.66426606518991293e-17},
+  {+2.25083911359792832e-01, +3.95070408225565255e-18, +9.74339382785575858e-01, +2.30412214761515275e-18},
+  {+2.28072083170885731e-01, +8.23618373392580116e-18, +9.73644249650811977e-01, -5.17298086910058649e-17},
+  {+2.31058108280671110e-01, +1.01297871497618686e-17, +9.72939952205560177e-01, -3.13112111222817999e-17},
+  {+2.34041958583543430e-01, -6.99224026961011726e-18, +9.72226497078936269e-01, +3.64611697859382275e-17},
+  {+2.37023605994367198e-01, +8.85448522850399026e-18, +9.71503890986251784e-01, -7.98654211222890920e-18},
+  {+2.40003022448741499e-01, -1.21377589756321624e-17, +9.70772140728950350e-01, -4.79921633251149280e-17},
+  {+2.42980179903263899e-01, -8.75143152971966624e-18, +9.70031253194543974e-01, +1.83653003484288413e-17},
+  {+2.45955050335794623e-01, -1.11290440527418303e-17, +9.69281235356548532e-01, -4.56636602619278893e-17},
+  {+2.48927605745720176e-01, -8.17834361000209898e-18, +9.68522094274417267e-01, +4.94750749182447894e-17},
+  {+2.51897818154216968e-01, -1.75914360325170510e-17, +9.67753837093475511e-01, -4.55121328255158199e-17},
+  {+2.54865659604514572e-01, -1.36022998069016972e-19, +9.66976471044852071e-01, +3.84962288373378703e-17},
+  {+2.57831102162158987e-01, +1.84800386308799536e-17, +9.66190003445412504e-01, +5.12988404016654925e-17},
+  {+2.60794117915275514e-01, +4.27214209835500826e-18, +9.65394441697689398e-01, -2.37453899183921532e-17},
+  {+2.63754678974831402e-01, -1.88379476800386965e-17, +9.64589793289812758e-01, -3.41894707359597918e-17},
+  {+2.66712757474898365e-01, +2.09412225788266823e-17, +9.63776065795439840e-01, +2.64639505612200319e-17},
+  {+2.69668325572915091e-01, +1.57656576181332587e-17, +9.62953266873683877e-01, +8.93419604043136648e-18},
+  {+2.72621355449948977e-01, +7.86971660763878500e-18, +9.62121404269041580e-01, +1.52367704538462924e-17},
+  {+2.75571819310958144e-01, +1.93203289625565878e-17, +9.61280485811320640e-01, +2.09339552166739736e-18},
+  {+2.78519689385053115e-01, -1.00302737195435424e-17, +9.60430519415565787e-01, +2.46539048153171913e-17},
+  {+2.81464937925757996e-01, -1.23222996412740139e-17, +9.59571513081984517e-01, +1.10006400850009539e-17},
+  {+2.84407537211271821e-01, +2.22092685106614784e-17, +9.58703474895871599e-01, -4.36850143923720533e-17},
+  {+2.87347459544729511e-01, +1.54611173676457139e-17, +9.57826413027532908e-01, -1.76967100753712596e-17},
+  {+2.90284677254462387e-01, -1.89279787077742484e-17, +9.56940335732208824e-01, +4.05538698618757067e-17},
+  {+2.93219162694258628e-01, +2.23854308119018331e-17, +9.56045251349996406e-01, +3.77050452795890793e-17},
+  {+2.96150888243623844e-01, -2.02207363608769288e-17, +9.55141168305770671e-01, +5.00886529550146743e-17},
+  {+2.99079826308040475e-01, +1.67011816092194698e-18, +9.54228095109105667e-01, -3.75459016906268803e-17},
+  {+3.02005949319228084e-01, -1.71676662352624712e-17, +9.53306040354193862e-01, -2.51907387799199336e-17},
+  {+3.04929229735402429e-01, -2.29890338981912620e-17, +9.52375012719765879e-01, -2.02693004622992721e-17},
+  {+3.07849640041534867e-01, +2.70740885272451850e-17, +9.51435020969008338e-01, +3.13505841232666766e-17},
+  {+3.10767152749611475e-01, +2.08870763640485161e-17, +9.50486073949481702e-01, +1.94100975626304361e-17},
+  {+3.13681740398891462e-01, +1.45604472999689122e-17, +9.49528180593036675e-01, -7.55441519280433292e-18},
+  {+3.16593375556165846e-01, +2.14352925127262801e-17, +9.48561349915730267e-01, +2.06682622623332347e-17},
+  {+3.19502030816015692e-01, -1.39815624910966233e-17, +9.47585591017741091e-01, +4.34179938521259905e-17},
+  {+3.22407678801069852e-01, -4.05190399379594136e-18, +9.46600913083283535e-01, +3.50568002106807366e-17},
+  {+3.25310292162262926e-01, +7.91712494637658309e-18, +9.45607325380521280e-01, +4.60191024785237440e-17},
+  {+3.28209843579092553e-01, -2.66931407196418928e-17, +9.44604837261480257e-01, +8.81005454766411035e-18},
+  {+3.31106305759876429e-01, -2.74694654747786878e-17, +9.43593458161960386e-01, -2.40931278444042141e-17},
+  {+3.33999651442009382e-01, +2.25989868062881449e-17, +9.42573197601446866e-01, +1.32355648064368816e-17},
+  {+3.36889853392220051e-01, -4.20009400334747649e-19, +9.41544065183020806e-01, -2.78963795476983349e-17},
+  {+3.39776884406826851e-01, +6.60286794994182819e-18, +9.40506070593268295e-01, +2.86104215671162560e-17},
+  {+3.42660717311994378e-01, +1.92615184493063096e-17, +9.39459223602189919e-01, -7.01528679430986240e-18},
+  {+3.45541324963989038e-01, +2.72511436729161327e-17, +9.38403534063108058e-01, +5.42425450447954777e-17},
+  {+3.48418680249434565e-01, +3.69744205142049254e-18, +9.37339011912574960e-01, -3.65709262843627702e-17},
+  {+3.51292756085567148e-01, -2.26707120987958406e-17, +9.36265667170278260e-01, -1.30137661454976568e-17},
+  {+3.54163525420490399e-01, -1.69517633057648571e-17, +9.35183509938947610e-01, -3.26093953024850650e-17},
+  {+3.57030961233430033e-01, -4.82181911379191658e-19, +9.34092550404258870e-01, +4.46628243607675052e-17},
+  {+3.59895036534988166e-01, -1.76016871238392733e-17, +9.32992798834738846e-01, +4.20414155553843615e-17},
+  {+3.62755724367397225e-01, -9.16683526637498492e-18, +9.31884265581668148e-01, -4.07859443773181010e-17},
+  {+3.65612997804773854e-01, +1.62178987704575461e-17, +9.30766961078983712e-01, +1.97037751028383325e-17},
+  {+3.68466829953372321e-01, +1.04636407961592684e-17, +9.29640895843181214e-01, +5.12825300168641194e-17},
+  {+3.71317193951837543e-01, +3.47492396482386219e-19, +9.28506080473215589e-01, -2.33066398484859367e-17},
+  {+3.74164062971457989e-01, +8.01141037619622256e-18, +9.27362525650401115e-01, -2.76771116921554342e-17},
+  {+3.77007410216418259e-01, -2.72553020419569607e-18, +9.26210242138311379e-01, -3.73037545860990542e-17},
+  {+3.79847208924051161e-01, +9.91513058551723859e-18, +9.25049240782677584e-01, +6.05294474125761357e-18},
+  {+3.82683432365089782e-01, -1.00507726964615830e-17, +9.23879532511286738e-01, +1.76450470843366863e-17},
+  {+3.85516053843918849e-01, +1.51776653964723165e-17, +9.22701128333878517e-01, +5.29637989185397953e-17},
+  {+3.88345046698826302e-01, -1.00537705983987123e-17, +9.21514039342041902e-01, +4.16398433906846374e-17},
+  {+3.91170384302253871e-01, +1.79977878582439952e-17, +9.20318276709110594e-01, -2.78068887790368375e-17},
+  {+3.93992040061048099e-01, +9.76492416412393052e-18, +9.19113851690057770e-01, -2.64964846223447057e-17},
+  {+3.96809987416710308e-01, +2.05450636708401260e-17, +9.17900775621390497e-01, -3.90745796808495149e-17},
+  {+3.99624199845646844e-01, -1.50654974761893716e-17, +9.16679059921042705e-01, -4.17339786982875676e-17},
+  {+4.02434650859418430e-01, +1.09026193393282773e-17, +9.15448716088267833e-01, -1.35910566929008802e-17},
+  {+4.05241314004989861e-01, +9.91114019428998842e-18, +9.14209755703530691e-01, -3.63161825278144292e-17},
+  {+4.08044162864978688e-01, -7.00060151373513261e-18, +9.12962190428398213e-01, -4.79325052280394689e-17},
+  {+4.10843171057903966e-01, -2.42198351903555024e-17, +9.11706032005429878e-01, -2.69132731750341363e-17},
+  {+4.13638312238434558e-01, -1.03939849405978724e-17, +9.10441292258067247e-01, -5.04330416733138319e-17},
+  {+4.16429560097637208e-01, -2.54755804131317323e-17, +9.09167983090522380e-01, -3.68785640913599869e-18},
+  {+4.19216888363223961e-01, -4.22324637501105588e-18, +9.07886116487666261e-01, -4.94599643012258519e-17},
+  {+4.22000270799799682e-01, +4.35432669941285352e-18, +9.06595704514915335e-01, +3.05067189554420234e-17},
+  {+4.24779681209108806e-01, +2.74623122042772842e-17, +9.05296759318118816e-01, -4.11530998268898887e-17},
+  {+4.27555093430282085e-01, +9.41118981629547262e-18, +9.03989293123443338e-01, -6.60975446874843547e-18},
+  {+4.30326481340082612e-01, +2.22596869740926959e-17, +9.02673318237258826e-01, -1.92507870339614799e-17},
+  {+4.33093818853151957e-01, +1.12242833298475230e-17, +9.01348847046022028e-01, -1.35247893676986727e-17},
+  {+4.35857079922255475e-01, +1.62305154506445301e-17, +9.00015892016160279e-01, -5.06396180508022727e-17},
+  {+4.38616238538527659e-01, -2.08833158310750902e-17, +8.98674465693953817e-01, +2.63169064610330166e-17},
+  {+4.41371268731716671e-01, +2.23607838869649750e-17, +8.97324580705418318e-01, -3.63962833148672899e-17},
+  {+4.44122144570429256e-01, -2.42188744221783147e-17, +8.95966249756185107e-01, +4.90250991148118070e-17},
+  {+4.46868840162374215e-01, -1.92221361423093854e-17, +8.94599485631382696e-01, -1.75162263968149284e-17},
+  {+4.49611329654606595e-01, +4.88319242320352512e-18, +8.93224301195515324e-01, -4.11612391519088434e-18},
+  {+4.52349587233770889e-01, -1.48279774721961192e-17, +8.91840709392342723e-01, +4.66902281371247083e-18},
+  {+4.55083587126343836e-01, -1.23799067581164736e-17, +8.90448723244757878e-01, +1.17819314590518048e-17},
+  {+4.57813303598877230e-01, -8.45542549222959487e-18, +8.89048355854664574e-01, -1.11645149667666704e-17},
+  {+4.60538710958240005e-01, +1.84887774921778687e-17, +8.87639620402853935e-01, +1.28050919185879774e-17},
+  {+4.63259783551860205e-01, -7.35149245332317375e-18, +8.86222530148880638e-01, -6.73073696002742298e-18},
+  {+4.65976495767966181e-01, -3.30235477782351007e-18, +8.84797098430937790e-01, -9.43314696289727978e-18},
+  {+4.68688822035827957e-01, -2.29492516818450603e-17, +8.83363338665731579e-01, +1.58226433802551212e-17},
+  {+4.71396736825997642e-01, +6.51667813606902067e-18, +8.81921264348355050e-01, -1.98432484058905437e-17},
+  {+4.74100214650550023e-01, -8.14516015489780598e-18, +8.80470889052160754e-01, +1.63110966029963472e-17},
+  {+4.76799230063322144e-01, -1.02935153383058006e-17, +8.79012226428633525e-01, -4.73568372911180108e-17},
+  {+4.79493757660153008e-01, +1.84199996626847708e-17, +8.77545290207261242e-01, +5.01133118464995378e-17},
+  {+4.82183772079122774e-01, -2.58615009255204481e-17, +8.76070094195406601e-01, +5.87290242351476460e-18},
+  {+4.84869248000791120e-01, -1.80340042032622450e-17, +8.74586652278176113e-01, -5.72166177303976236e-19},
+  {+4.87550160148435940e-01, +1.42310909312736532e-17, +8.73094978418290091e-01, +7.84246729901299796e-18},
+  {+4.90226483288291159e-01, -5.14961456434403964e-18, +8.71595086655951090e-01, -5.52729980385510496e-17},
+  {+4.92898192229784038e-01, -1.02578316765622125e-18, +8.70086991108711461e-01, -4.18885108685499559e-17},
+  {+4.95565261825772541e-01, -9.43232419423653462e-18, +8.68570705971340895e-01, +2.71927816897815984e-19},
+  {+4.98227666972781869e-01, -1.61263838305408008e-17, +8.67046245515692648e-01, +3.02678595509305128e-18},
+  {+5.00885382611240826e-01, -3.96040151470746449e-17, +8.65513624090569089e-01, -6.37231135496290067e-18},
+  {+5.03538383725717575e-01, -1.67313082049675031e-17, +8.63972856121586696e-01, +4.14863559573616133e-17},
+  {+5.06186645345155339e-01, -4.83215929864937173e-17, +8.62423956111040502e-01, +3.70089925273831237e-17},
+  {+5.08830142543106989e-01, +4.78369682680141236e-17, +8.60866938637767309e-01, -3.00500488985736500e-17},
+  {+5.11468850437970413e-01, -1.30880012210076051e-17, +8.59301818357008362e-01, +4.24356558168506934e-17},
+  {+5.14102744193221772e-01, -4.57127075236156486e-17, +8.57728610000272118e-01, -4.81834479363366201e-17},
+  {+5.16731799017649873e-01, +8.30186172338363613e-18, +8.56147328375194472e-01, +9.18069256166062452e-18},
+  {+5.19355990165589643e-01, -5.53312481441711574e-17, +8.54557988365400534e-01, -1.29911242363960916e-17},
+  {+5.21975292937154389e-01, -4.65557956920888952e-17, +8.52960604930363631e-01, +2.71529842519813666e-17},
+  {+5.24589682678468949e-01, -4.30688690400823386e-17, +8.51355193105265196e-01, -5.32798744460161902e-17},
+  {+5.27199134781901391e-01, -4.22029834805606191e-17, +8.49741768000852438e-01, +5.18123476599740093e-17},
+  {+5.29803624686294716e-01, -4.80678417064823481e-17, +8.48120344803297233e-01, +1.87625634152399841e-17},
+  {+5.32403127877198012e-01, -4.10203061358009201e-17, +8.46490938774052126e-01, -4.79694199585693575e-17},
+  {+5.34997619887097264e-01, -5.36831327083581525e-17, +8.44853565249707117e-01, -4.36313602968796433e-17},
+  {+5.37587076295645505e-01, -2.26173653884030635e-17, +8.43208239641845436e-01, +9.65367070059601746e-19},
+  {+5.40171472729892854e-01, +2.70724479659358265e-17, +8.41554977436898444e-01, -3.40954653913215505e-17},
+  {+5.42750784864515889e-01, +1.71482610047571013e-17, +8.39893794195999521e-01, -1.66736948815113990e-17},
+  {+5.45324988422046464e-01, -4.15178175383842701e-17, +8.38224705554838079e-01, -3.55600850528550076e-17},
+  {+5.47894059173100190e-01, -2.40658782971133627e-17, +8.36547727223512005e-01, -2.08990590270665387e-17},
+  {+5.50457972936604811e-01, -8.33199030158076940e-18, +8.34862874986380010e-01, +4.60484306091596697e-17},
+  {+5.53016705580027579e-01, -4.70615366237982100e-17, +8.33170164701913185e-01, +1.32751295072297875e-18},
+  {+5.55570233019602178e-01, +4.70941094056167621e-17, +8.31469612302545236e-01, +1.40738569847280701e-18},
+  {+5.58118531220556102e-01, +1.34811763247652352e-17, +8.29761233794523045e-01, -2.93491093764856126e-18},
+  {+5.60661576197336031e-01, -7.39564181534761055e-18, +8.28045045257755796e-01, -4.41965932258715260e-17},
+  {+5.63199344013834091e-01, +2.38357751468548474e-17, +8.26321062845663534e-01, -5.39574854536128955e-17},
+  {+5.65731810783613231e-01, -3.40960795965904665e-17, +8.24589302785025291e-01, -2.65123604888682721e-17},
+  {+5.68258952670131601e-01, -5.09356736427692352e-17, +8.22849781375826317e-01, +1.51930190345054916e-17},
+  {+5.70780745886967256e-01, +2.45681514555662044e-17, +8.21102514991104648e-01, +3.07151316096976817e-17},
+  {+5.73297166698042204e-01, +8.51766116693063844e-18, +8.19347520076797009e-01, -4.82007369951911332e-17},
+  {+5.75808191417845339e-01, -3.79094954589427465e-17, +8.17584813151583711e-01, -1.48831498124267687e-17},
+  {+5.78313796411655590e-01, -2.62376915123728308e-17, +8.15814410806733781e-01, +8.26526937821307935e-18},
+  {+5.80813958095764526e-01, +1.85853385866134173e-17, +8.14036329705948414e-01, -5.21273518770426242e-17},
+  {+5.83308652937698291e-01, +3.45166010790448430e-18, +8.12250586585203882e-01, +3.10545456092148025e-17},
+  {+5.85797857456438864e-01, -3.74855019643113167e-18, +8.10457198252594768e-01, +2.35203673498404867e-17},
+  {+5.88281548222645334e-01, -2.92921667250068212e-17, +8.08656181588174983e-01, +9.32515978797216739e-18},
+  {+5.90759701858874275e-01, -4.70135841706595359e-17, +8.06847553543799223e-01, +4.92206037660955396e-17},
+  {+5.93232295039799795e-01, +1.28923209441890764e-17, +8.05031331142963547e-01, +5.13682895682121424e-17},
+  {+5.95699304492433357e-01, -1.34386419365794719e-17, +8.03207531480644943e-01, -3.30606098048149219e-17},
+  {+5.98160706996342273e-01, +3.88018857830006698e-17, +8.01376171723140240e-01, -2.09580134134958282e-17},
+  {+6.00616479383868973e-01, -4.63981982294619322e-17, +7.99537269107905013e-01, +2.03567238220054308e-17},
+  {+6.03066598540348164e-01, +3.73233576805596682e-17, +7.97690840943391155e-01, -4.67307598847889437e-17},
+  {+6.05511041404325545e-01, -3.12026724933056708e-17, +7.95836904608883566e-01, -3.00627248519107149e-17},
+  {+6.07949784967773632e-01, +3.51608323620966603e-17, +7.93975477554337172e-01, -7.41946317599215705e-18},
+  {+6.10382806276309475e-01, -2.25632656482291749e-17, +7.92106577300212389e-01, -3.70878502023264790e-17},
+  {+6.12810082429409708e-01, -4.26934765684096233e-18, +7.90230221437310032e-01, +2.30569059549544919e-17},
+  {+6.15231590580626819e-01, +2.62314177672669533e-17, +7.88346427626606228e-01, +3.43969931540597076e-17},
+  {+6.17647307937803980e-01, -4.74785945109024519e-17, +7.86455213599085767e-01, -9.78414299393052345e-18},
+  {+6.20057211763289207e-01, -2.79834108376811245e-17, +7.84556597155575242e-01, -8.56279654231735373e-18},
+  {+6.22461279374149967e-01, +5.29407286065730404e-18, +7.82650596166575729e-01, +9.07458669758088248e-18},
+  {+6.24859488142386343e-01, +3.36718460372438880e-17, +7.80737228572094488e-01, -9.91987820666788214e-18},
+  {+6.27251815495144083e-01, +3.07635851812532250e-17, +7.78816512381475978e-01, -2.48913855799738096e-17},
+  {+6.29638238914926984e-01, +4.11153340496268119e-17, +7.76888465673232442e-01, +7.74186025706728327e-18},
+  {+6.32018735939809062e-01, -4.01649422964636124e-17, +7.74953106594873931e-01, -5.22090831898264265e-17},
+  {+6.34393284163645488e-01, +1.04209019292800392e-17, +7.73010453362736993e-01, -3.25659070336497662e-17},
+  {+6.36761861236284199e-01, +3.14190487119015923e-17, +7.71060524261813818e-01, -4.45584423477692588e-17},
+  {+6.39124444863775731e-01, +1.24167963122710412e-17, +7.69103337645579588e-01, +5.15464551845648228e-17},
+  {+6.41481012808583162e-01, -9.98834301159433866e-18, +7.67138911935820400e-01, -1.88859036837507816e-17},
+  {+6.43831542889791497e-01, -3.20847987950468858e-17, +7.65167265622458959e-01, -3.27072256125345983e-17},
+  {+6.46176012983316395e-01, -2.97561373822808148e-17, +7.63188417263381269e-01, +2.63147484167506791e-18},
+  {+6.48514401022112441e-01, +3.98702703133867848e-18, +7.61202385484261779e-01, +3.53155108816905509e-17},
+  {+6.50846684996380875e-01, +3.97146707105002695e-17, +7.59209188978388072e-01, -3.85588421755231226e-17},
+  {+6.53172842953776756e-01, +8.56956420600262688e-18, +7.57208846506484567e-01, -1.99090987773354988e-17},
+  {+6.55492852999615350e-01, +3.56387344263850047e-17, +7.55201376896536547e-01, -1.94022380018230266e-17},
+  {+6.57806693297078637e-01, +1.95809430584685393e-17, +7.53186799043612520e-01, -3.79377898387365335e-17},
+  {+6.60114342067420479e-01, -1.39600543868238060e-19, +7.51165131909686368e-01, +4.34997611586458745e-17},
+  {+6.62415777590171784e-01, -2.26155088857646007e-17, +7.49136394523459370e-01, -4.47290784470118948e-17},
+  {+6.64710978203344904e-01, -3.62277935980343794e-17, +7.47100605980180132e-01, +1.18748248759654396e-17},
+  {+6.66999922303637471e-01, +3.52843649974281718e-17, +7.45057785441465947e-01, +1.50786869118778443e-17},
+  {+6.69282588346636120e-01, -5.45926524174479003e-17, +7.43007952135121719e-01, -2.51446296697192681e-17},
+  {+6.71558954847018441e-01, -4.04890377492966801e-17, +7.40951125354959106e-01, -1.47086169522973513e-17},
+  {+6.73829000378756038e-01, +2.30919012361610926e-17, +7.38887324460615114e-01, +3.43248748082250910e-17},
+  {+6.76092703575315923e-01, +3.72569022480494661e-17, +7.36816568877369904e-01, -2.89324681016563196e-17},
+  {+6.78350043129861469e-01, +1.83020930418631220e-17, +7.34738878095963499e-01, -3.45075959762639473e-17},
+  {+6.80600997795453022e-01, +2.84732933545220469e-17, +7.32654271672412816e-01, +1.89186734815734980e-17},
+  {+6.82845546385248081e-01, -1.29580580615245355e-17, +7.30562769227827591e-01, -2.96899599044769341e-17},
+  {+6.85083667772700355e-01, +2.59481351946451434e-17, +7.28464390448225196e-01, +1.19246423233708596e-19},
+  {+6.87315340891759163e-01, -5.51561587149171559e-17, +7.26359155084346009e-01, -3.19175024434605356e-17},
+  {+6.89540544737066941e-01, -1.58893232948067837e-17, +7.24247082951466892e-01, +2.91984713344030044e-17},
+  {+6.91759258364157748e-01, +2.74060784724106713e-17, +7.22128193929215345e-01, -2.38712620534520566e-17},
+  {+6.93971460889654002e-01, +7.43450769562801986e-18, +7.20002507961381655e-01, -2.56896588544623395e-17},
+  {+6.96177131491462986e-01, -4.12240812135828953e-17, +7.17870045055731709e-01, +2.70064760625114594e-17},
+  {+6.98376249408972805e-01, +4.89882824356677615e-17, +7.15730825283818706e-01, -5.15810184764102558e-17},
+  {+7.00568793943248336e-01, +3.10279601929929280e-17, +7.13584868780793635e-01, -4.23425044031335842e-17},
+  {+7.02754744457225300e-01, +2.52782943836298140e-18, +7.11432195745216434e-01, +7.96432986138568280e-18},
+  {+7.04934080375904881e-01, +2.76087255857485078e-17, +7.09272826438865689e-01, -3.75973591102457242e-17},
+  {+7.07106781186547573e-01, -4.83364665672645611e-17, +7.07106781186547573e-01, -4.83364665672645611e-17}
+};
+
+#endif
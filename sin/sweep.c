@@ -0,0 +1,351 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <time.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "mysin.h"
+#include "functions.h"
+#include "accuracy.h"
+
+char* help_string =
+  "sweep - Error of a sin function in ulp at every float argument.\n"
+  "usage: sweep [-h]\n"
+  "       sweep [-A fname] [-j threads] [-b] [-c file] [-i seconds] [-t ulp]\n"
+  "             [-r first,last]\n\n"
+  "    -A fname            Function to check, as in benchmark -L.  Default sinf3\n"
+  "    -j threads          Worker threads.  Default one per CPU.\n"
+  "    -b                  Check the batch entry point where there is one.\n"
+  "    -c file             Checkpoint file.  If it exists the sweep carries on\n"
+  "                        from it, and it is rewritten as the sweep goes and\n"
+  "                        when it is interrupted.\n"
+  "    -i seconds          Time between checkpoints.  Default 60\n"
+  "    -t ulp              Exit with status 1 if the max error is above ulp.\n"
+  "    -r first,last       Only the float bit patterns first to last, in hex,\n"
+  "                        rounded out to whole blocks.  Default 0,ffffffff\n"
+  "    -h                  Display this help.\n\n"
+  "The 2^32 bit patterns are split into blocks of 2^20.  Each thread starts\n"
+  "with an equal run of blocks and, when it is through them, takes half of\n"
+  "what is left of the busiest thread's run.  Double precision functions are\n"
+  "given the float arguments and measured in double ulps.\n";
+
+#define BLOCK_BITS 20
+#define BLOCKS (1u << (32 - BLOCK_BITS))
+#define CHUNK 4096              // arguments per batch call
+#define MAX_THREADS 1024
+
+static const char checkpoint_magic[8] = "sweep01";
+
+// A thread's run of blocks, next << 32 | end.  The owner takes next;
+// thieves move end down.  Both change it with a compare and swap.
+struct run {
+  _Alignas(64) _Atomic uint64_t r;
+};
+
+struct sweep {
+  struct function_item *f;
+  int           mant_bits;
+  int           nthreads;
+  struct run    *runs;
+  struct acc_stats *block;      // stats of each finished block
+  _Atomic uint8_t *done;        // block[b] is final once done[b] is set
+  _Atomic uint32_t ndone;
+};
+
+static volatile sig_atomic_t stop;
+
+static void on_signal(int sig) {
+  (void)sig;
+  stop = 1;
+}
+
+static inline uint64_t run_make(uint32_t next, uint32_t end) {
+  return (uint64_t)next << 32 | end;
+}
+
+// Take the next block of a run, or return 0 if it is empty.
+static int run_take(struct run *run, uint32_t *b) {
+  uint64_t r = atomic_load(&run->r);
+  for (;;) {
+    uint32_t next = r >> 32, end = (uint32_t)r;
+    if (next >= end) return 0;
+    if (atomic_compare_exchange_weak(&run->r, &r, run_make(next + 1, end))) {
+      *b = next;
+      return 1;
+    }
+  }
+}
+
+// Move the back half of the longest other run to thread t.
+static int run_steal(struct sweep *s, int t) {
+  for (;;) {
+    int victim = -1;
+    uint32_t most = 0;
+    uint64_t r = 0;
+    for (int v = 0; v < s->nthreads; v++) {
+      uint64_t rv = atomic_load(&s->runs[v].r);
+      uint32_t left = (uint32_t)rv > rv >> 32 ? (uint32_t)rv - (uint32_t)(rv >> 32) : 0;
+      if (v != t && left > most) {
+        most = left;
+        victim = v;
+        r = rv;
+      }
+    }
+    if (victim < 0) return 0;
+    uint32_t next = r >> 32, end = (uint32_t)r;
+    uint32_t mid = end - (end - next + 1) / 2;
+    if (atomic_compare_exchange_strong(&s->runs[victim].r, &r, run_make(next, mid))) {
+      atomic_store(&s->runs[t].r, run_make(mid, end));
+      return 1;
+    }
+  }
+}
+
+static void check_block(struct sweep *s, uint32_t b, struct acc_stats *a,
+                        float *xf, float *yf, double *x, double *y) {
+  struct function_item *f = s->f;
+  uint32_t first = b << BLOCK_BITS;
+  acc_clear(a, s->mant_bits);
+  for (uint32_t i0 = 0; i0 < (1u << BLOCK_BITS); i0 += CHUNK) {
+    for (int i = 0; i < CHUNK; i++) {
+      uint32_t u = first + i0 + i;
+      memcpy(&xf[i], &u, sizeof(float));
+      x[i] = xf[i];
+    }
+    if (f->fbatch_ptr != NULL) {
+      f->fbatch_ptr(xf, yf, CHUNK);
+      for (int i = 0; i < CHUNK; i++) y[i] = yf[i];
+    } else if (f->ff_ptr != NULL) {
+      for (int i = 0; i < CHUNK; i++) y[i] = f->ff_ptr(xf[i]);
+    } else if (f->batch_ptr != NULL) {
+      f->batch_ptr(x, y, CHUNK);
+    } else {
+      for (int i = 0; i < CHUNK; i++) y[i] = f->f_ptr(x[i]);
+    }
+    for (int i = 0; i < CHUNK; i++) {
+      acc_add(a, x[i], y[i], sin_ref(x[i]));
+    }
+  }
+}
+
+struct worker {
+  struct sweep *s;
+  int           t;
+};
+
+static void *sweep_blocks(void *arg) {
+  struct worker *w = arg;
+  struct sweep *s = w->s;
+  float *xf = malloc(CHUNK * sizeof(float));
+  float *yf = malloc(CHUNK * sizeof(float));
+  double *x = malloc(CHUNK * sizeof(double));
+  double *y = malloc(CHUNK * sizeof(double));
+  struct acc_stats a;
+
+  while (!stop) {
+    uint32_t b;
+    if (!run_take(&s->runs[w->t], &b)) {
+      if (!run_steal(s, w->t)) break;
+      continue;
+    }
+    if (atomic_load_explicit(&s->done[b], memory_order_relaxed)) continue;
+    check_block(s, b, &a, xf, yf, x, y);
+    s->block[b] = a;
+    atomic_store_explicit(&s->done[b], 1, memory_order_release);
+    atomic_fetch_add(&s->ndone, 1);
+  }
+  free(xf);
+  free(yf);
+  free(x);
+  free(y);
+  return NULL;
+}
+
+// The checkpoint is the magic, the function name, and the index and
+// stats of every finished block.  It is written to file.tmp and renamed,
+// so an interruption leaves the old one whole.
+static void write_checkpoint(struct sweep *s, const char *path) {
+  char tmp[4096];
+  snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+  FILE *out = fopen(tmp, "wb");
+  if (out == NULL) {
+    perror(tmp);
+    return;
+  }
+  char name[32] = {0};
+  strncpy(name, s->f->f_name, sizeof(name) - 1);
+  fwrite(checkpoint_magic, sizeof(checkpoint_magic), 1, out);
+  fwrite(name, sizeof(name), 1, out);
+  for (uint32_t b = 0; b < BLOCKS; b++) {
+    if (!atomic_load_explicit(&s->done[b], memory_order_acquire)) continue;
+    fwrite(&b, sizeof(b), 1, out);
+    fwrite(&s->block[b], sizeof(struct acc_stats), 1, out);
+  }
+  if (fclose(out) != 0 || rename(tmp, path) != 0) {
+    perror(path);
+  }
+}
+
+// Returns the number of blocks read, or -1 if the file is for something else.
+static int read_checkpoint(struct sweep *s, const char *path) {
+  FILE *in = fopen(path, "rb");
+  if (in == NULL) return 0;
+  char magic[sizeof(checkpoint_magic)];
+  char name[32];
+  if (fread(magic, sizeof(magic), 1, in) != 1 || fread(name, sizeof(name), 1, in) != 1
+      || memcmp(magic, checkpoint_magic, sizeof(magic)) != 0
+      || strncmp(name, s->f->f_name, sizeof(name) - 1) != 0) {
+    fclose(in);
+    return -1;
+  }
+  int n = 0;
+  uint32_t b;
+  struct acc_stats a;
+  while (fread(&b, sizeof(b), 1, in) == 1 && fread(&a, sizeof(a), 1, in) == 1) {
+    if (b >= BLOCKS || a.mant_bits != s->mant_bits) break;
+    s->block[b] = a;
+    if (!atomic_exchange(&s->done[b], 1)) n++;
+  }
+  fclose(in);
+  return n;
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9 * ts.tv_nsec;
+}
+
+int main(int argc, char **argv) {
+  struct function_item f = {"sinf3"};
+  int nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  int batch = 0;
+  const char *checkpoint = NULL;
+  double interval = 60.0;
+  double threshold = -1.0;
+  uint32_t first = 0, last = 0xffffffff;
+
+  int c;
+  while ((c = getopt(argc, argv, "A:j:bc:i:t:r:h")) != -1) {
+    switch (c) {
+    case 'A':
+      f.f_name = optarg;
+      break;
+    case 'j':
+      nthreads = atoi(optarg);
+      break;
+    case 'b':
+      batch = 1;
+      break;
+    case 'c':
+      checkpoint = optarg;
+      break;
+    case 'i':
+      interval = atof(optarg);
+      break;
+    case 't':
+      threshold = atof(optarg);
+      break;
+    case 'r':
+      if (sscanf(optarg, "%x,%x", &first, &last) != 2 || first > last) {
+        fprintf(stderr, "Please give -r as first,last in hex, first <= last.\n");
+        exit(1);
+      }
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(1);
+    }
+  }
+  if (!find_function(&f)) {
+    fprintf(stderr, "Unable to find function: %s\n", f.f_name);
+    exit(1);
+  }
+  if (!batch) {
+    f.batch_ptr = NULL;
+    f.fbatch_ptr = NULL;
+  }
+  if (nthreads < 1) nthreads = 1;
+  if (nthreads > MAX_THREADS) nthreads = MAX_THREADS;
+
+  struct sweep s = {&f, f.ff_ptr != NULL ? 24 : 53, nthreads};
+  s.runs = aligned_alloc(64, nthreads * sizeof(struct run));
+  s.block = malloc(BLOCKS * sizeof(struct acc_stats));
+  s.done = calloc(BLOCKS, sizeof(*s.done));
+  acc_init();
+
+  uint32_t b0 = first >> BLOCK_BITS, b1 = (last >> BLOCK_BITS) + 1;
+  if (checkpoint != NULL) {
+    int n = read_checkpoint(&s, checkpoint);
+    if (n < 0) {
+      fprintf(stderr, "%s is a checkpoint for another function.\n", checkpoint);
+      exit(1);
+    }
+    if (n > 0) fprintf(stderr, "%d blocks from %s\n", n, checkpoint);
+  }
+  uint32_t todo = 0;
+  for (uint32_t b = b0; b < b1; b++) todo += !s.done[b];
+  for (int t = 0; t < nthreads; t++) {
+    uint32_t lo = b0 + (uint64_t)(b1 - b0) * t / nthreads;
+    uint32_t hi = b0 + (uint64_t)(b1 - b0) * (t + 1) / nthreads;
+    atomic_init(&s.runs[t].r, run_make(lo, hi));
+  }
+
+  signal(SIGINT, on_signal);
+  signal(SIGTERM, on_signal);
+  fprintf(stderr, "%s%s: %u blocks of %u floats, %d threads\n", f.f_name,
+          f.fbatch_ptr != NULL || f.batch_ptr != NULL ? " (batch)" : "",
+          todo, 1u << BLOCK_BITS, nthreads);
+
+  pthread_t tid[nthreads];
+  struct worker w[nthreads];
+  double t0 = now(), saved = t0;
+  for (int t = 0; t < nthreads; t++) {
+    w[t] = (struct worker){&s, t};
+    pthread_create(&tid[t], NULL, sweep_blocks, &w[t]);
+  }
+  // Report and checkpoint while the workers run.
+  while (!stop && atomic_load(&s.ndone) < todo) {
+    sleep(1);
+    double t = now();
+    uint32_t n = atomic_load(&s.ndone);
+    fprintf(stderr, "\r%u/%u blocks, %.0f s, %.3g floats/s   ", n, todo, t - t0,
+            n * (double)(1u << BLOCK_BITS) / (t - t0));
+    if (checkpoint != NULL && t - saved >= interval) {
+      write_checkpoint(&s, checkpoint);
+      saved = t;
+    }
+  }
+  for (int t = 0; t < nthreads; t++) {
+    pthread_join(tid[t], NULL);
+  }
+  fprintf(stderr, "\n");
+  if (checkpoint != NULL) write_checkpoint(&s, checkpoint);
+  if (stop) {
+    fprintf(stderr, "Interrupted after %u of %u blocks.\n", atomic_load(&s.ndone), todo);
+    exit(2);
+  }
+
+  // The threads are done, so the block stats are merged without locks.
+  struct acc_stats total;
+  acc_clear(&total, s.mant_bits);
+  for (uint32_t b = b0; b < b1; b++) {
+    acc_merge(&total, &s.block[b]);
+  }
+  printf("%s%s, floats 0x%08x to 0x%08x\n", f.f_name,
+         f.fbatch_ptr != NULL || f.batch_ptr != NULL ? " (batch)" : "",
+         b0 << BLOCK_BITS, (uint32_t)(((uint64_t)b1 << BLOCK_BITS) - 1));
+  acc_print(stdout, &total);
+  if (threshold >= 0.0 && !(total.max <= threshold)) {
+    printf("%12s max error %.4f ulp is above %g\n", "FAIL", total.max, threshold);
+    return 1;
+  }
+  return 0;
+}
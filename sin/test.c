@@ -4,17 +4,27 @@
 extern double sin_1(double x);
 extern double sin_2(double x);
 extern double sin_3(double x);
+extern double sin_4(double x);
+extern double sin_5(double x);
+extern float sinf_3(float x);
 
 void test_value(double x) {
-  double y, y1, y2, y3;
+  double y, y1, y2, y3, y4, y5;
+  float yf;
   y = gsl_sf_sin(x);
   y1 = sin_1(x);
   y2 = sin_2(x);
   y3 = sin_3(x);
+  y4 = sin_4(x);
+  y5 = sin_5(x);
+  yf = sinf_3((float)x);
   printf("gsl_sf_sin(%f) = %f\n", x, y);
   printf("Sin1(%f) = %f\n", x, y1);
   printf("Sin2(%f) = %f\n", x, y2);
   printf("Sin3(%f) = %f\n", x, y3);
+  printf("Sin4(%f) = %f\n", x, y4);
+  printf("Sin5(%f) = %f\n", x, y5);
+  printf("Sinf3(%f) = %f\n", x, yf);
   printf("\n");
 }
 
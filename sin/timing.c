@@ -0,0 +1,101 @@
+#if defined(__linux__)
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#if defined(__APPLE__)
+#include <pthread.h>
+#endif
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_cdf.h>
+#include <gsl/gsl_statistics_double.h>
+
+#include "timing.h"
+
+#if defined(__x86_64__)
+const char *timer_name = "rdtscp";
+#elif defined(__aarch64__)
+const char *timer_name = "cntvct_el0";
+#else
+const char *timer_name = "CLOCK_MONOTONIC_RAW";
+#endif
+double timer_ns_per_tick = 1.0;
+double timer_ghz = 0.0;
+uint64_t timer_overhead = 0;
+
+static double now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+void timer_init(void) {
+#if defined(__aarch64__)
+  uint64_t freq;
+  __asm__ volatile("mrs %0, cntfrq_el0" : "=r"(freq));
+  timer_ns_per_tick = 1e9 / freq;
+#elif defined(__x86_64__)
+  // The TSC runs at a fixed rate; count it over 20 ms.  It is close
+  // to the nominal clock, so it stands in for cycles.
+  double t0 = now_ns();
+  uint64_t c0 = timer_ticks();
+  while (now_ns() - t0 < 2e7)
+    ;
+  double t1 = now_ns();
+  uint64_t c1 = timer_ticks();
+  timer_ns_per_tick = (t1 - t0) / (c1 - c0);
+  timer_ghz = 1.0 / timer_ns_per_tick;
+#endif
+
+  uint64_t best = UINT64_MAX;
+  for (int i = 0; i < 1000; i++) {
+    uint64_t t0 = timer_ticks();
+    uint64_t t = timer_ticks() - t0;
+    if (t < best) best = t;
+  }
+  timer_overhead = best;
+}
+
+int timer_pin(int cpu) {
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return sched_setaffinity(0, sizeof(set), &set);
+#elif defined(__APPLE__)
+  (void)cpu;
+  return pthread_set_qos_class_self_np(QOS_CLASS_USER_INTERACTIVE, 0);
+#else
+  (void)cpu;
+  return -1;
+#endif
+}
+
+void timing_measure(uint64_t (*pass)(void *), void *ctx, double calls,
+                    const struct timing_opts *opts, struct timing *t) {
+  int max_reps = opts->max_reps > 2 ? opts->max_reps : 2;
+  int min_reps = opts->min_reps > 2 ? opts->min_reps : 2;
+  double *ns = malloc(max_reps * sizeof(double));
+  double mean = 0.0, half = 0.0;
+  int n = 0;
+
+  for (int i = 0; i < opts->warmup; i++) {
+    pass(ctx);
+  }
+  while (n < max_reps) {
+    ns[n++] = pass(ctx) * timer_ns_per_tick / calls;
+    if (n < min_reps) continue;
+    mean = gsl_stats_mean(ns, 1, n);
+    half = gsl_cdf_tdist_Pinv(0.975, n - 1) * gsl_stats_sd_m(ns, 1, n, mean) / sqrt(n);
+    if (half <= opts->rel_ci * mean) break;
+  }
+  free(ns);
+
+  double ghz = opts->ghz > 0 ? opts->ghz : timer_ghz;
+  t->ns = mean;
+  t->ns_ci = half;
+  t->cycles = mean * ghz;
+  t->cycles_ci = half * ghz;
+  t->reps = n;
+}
@@ -0,0 +1,70 @@
+// timing.h
+// Timer and repeat-until-stable measurement for benchmark.
+//
+// timer_ticks() reads the cheapest fine grained counter there is:
+// rdtscp on x86-64, cntvct_el0 on arm64, CLOCK_MONOTONIC_RAW
+// otherwise.  timer_init() works out how long a tick is and what an
+// empty start/stop costs; timer_elapsed() takes that cost off.
+
+#ifndef TIMING_H
+#define TIMING_H
+
+#include <stdint.h>
+#include <time.h>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+static inline uint64_t timer_ticks(void) {
+#if defined(__x86_64__)
+  unsigned aux;
+  return __rdtscp(&aux);        // waits for the calls before it
+#elif defined(__aarch64__)
+  uint64_t t;
+  __asm__ volatile("isb\n\tmrs %0, cntvct_el0" : "=r"(t) : : "memory");
+  return t;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+extern const char *timer_name;
+extern double timer_ns_per_tick;
+extern double timer_ghz;        // CPU cycles per ns, 0 if unknown
+extern uint64_t timer_overhead; // ticks for an empty start/stop
+
+static inline uint64_t timer_elapsed(uint64_t start) {
+  uint64_t t = timer_ticks() - start;
+  return t > timer_overhead ? t - timer_overhead : 0;
+}
+
+void timer_init(void);
+// Keep the process on one CPU (Linux) or ask for the performance
+// cores (macOS, which has no affinity).  Returns 0 on success.
+int timer_pin(int cpu);
+
+struct timing_opts {
+  int           warmup;         // untimed passes first
+  int           min_reps;       // then at least this many timed passes,
+  int           max_reps;       //   at most this many,
+  double        rel_ci;         //   stopping when the 95% CI is this
+                                //   fraction of the mean
+  double        ghz;            // for cycles; 0 means timer_ghz
+};
+
+struct timing {
+  double        ns;             // per call, mean over the passes
+  double        ns_ci;          // 95% confidence half-width
+  double        cycles;         // per call, 0 if the clock rate is unknown
+  double        cycles_ci;
+  int           reps;
+};
+
+// pass(ctx) makes `calls` calls and returns the ticks they took.
+void timing_measure(uint64_t (*pass)(void *), void *ctx, double calls,
+                    const struct timing_opts *opts, struct timing *t);
+
+#endif
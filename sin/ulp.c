@@ -0,0 +1,268 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_rng.h>
+
+#include "mysin.h"
+#include "functions.h"
+#include "accuracy.h"
+#include "distrib.h"
+
+char* help_string =
+  "ulp - Error of sin functions in ulp, against a double-double reference.\n"
+  "usage: ulp [-h]\n"
+  "       ulp [-A fname]... [-n npoints] [-m min -M max] [-D distribution] [-j threads]\n"
+  "           [-b] [-t ulp] [-K kernels]\n"
+  "       ulp [-A fname]... -x value\n\n"
+  "    -A fname            Function to check, as in benchmark -L; may be repeated.\n"
+  "                        -A all checks every Sin, not the reductions.\n"
+  "                        Default sin3\n"
+  "    -n npoints          Number of random x values, uniform on [min, max].\n"
+  "                        Default 1e7\n"
+  "    -m min -M max       Range of x.  Defaults min=-Pi max=Pi\n"
+  "    -D distribution     Draw x as benchmark -D does, instead of uniformly.\n"
+  "                        file:path checks every point of the file once, in\n"
+  "                        place of -n random ones, as in -D file:nearpi.bin\n"
+  "                        for the arguments hardest to reduce.\n"
+  "    -j threads          Worker threads.  Default one per CPU.\n"
+  "    -b                  Check the batch entry point where there is one.\n"
+  "    -t ulp              Exit with status 1 if any function's max error is\n"
+  "                        above ulp, so that a check can gate a change.\n"
+  "    -K kernels          Also offer the kernels of these shared objects, as\n"
+  "                        benchmark -K does.  A loaded kernel fails the check\n"
+  "                        if its max error is above the one it claims.\n"
+  "                        Default $MYSIN_KERNELS\n"
+  "    -x value            Show both results and the error at x=value only.\n"
+  "    -h                  Display this help.\n\n"
+  "Single precision functions get x rounded to float and are measured in\n"
+  "float ulps.  The seed comes from GSL_RNG_SEED, as for benchmark; with -n\n"
+  "and -D it fixes the points checked, whatever the number of threads.\n";
+
+#define MAX_FUNCTIONS 64
+#define CHUNK (1 << 16)         // points a thread takes at a time
+
+struct job {
+  struct function_item *f;
+  struct distrib *dist;
+  double        min_x;
+  double        max_x;
+  uint64_t      points;
+  _Atomic uint64_t next;        // first point not yet taken
+  pthread_mutex_t lock;
+  struct acc_stats stats;
+};
+
+static void *check_chunks(void *arg) {
+  struct job *job = arg;
+  struct function_item *f = job->f;
+  int single = f->ff_ptr != NULL;
+  double *x = malloc(CHUNK * sizeof(double));
+  double *y = malloc(CHUNK * sizeof(double));
+  float *xf = malloc(CHUNK * sizeof(float));
+  float *yf = malloc(CHUNK * sizeof(float));
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  struct acc_stats stats;
+  acc_clear(&stats, single ? 24 : 53);
+
+  for (;;) {
+    uint64_t i0 = atomic_fetch_add(&job->next, CHUNK);
+    if (i0 >= job->points) break;
+    int n = job->points - i0 < CHUNK ? job->points - i0 : CHUNK;
+
+    if (job->dist->kind == DIST_FILE) {
+      memcpy(x, job->dist->data + i0, n * sizeof(double));
+    } else {
+      // seeded by chunk, so the points don't depend on which thread
+      // takes it or how many there are
+      gsl_rng_set(r, gsl_rng_default_seed ^ (i0 / CHUNK) * 0x9e3779b97f4a7c15);
+      dist_fill(job->dist, r, x, n, job->min_x, job->max_x);
+    }
+    if (single) {
+      for (int i = 0; i < n; i++) {
+        xf[i] = (float)x[i];
+        x[i] = xf[i];
+      }
+      if (f->fbatch_ptr != NULL) {
+        f->fbatch_ptr(xf, yf, n);
+      } else {
+        for (int i = 0; i < n; i++) yf[i] = f->ff_ptr(xf[i]);
+      }
+      for (int i = 0; i < n; i++) y[i] = yf[i];
+    } else if (f->batch_ptr != NULL) {
+      f->batch_ptr(x, y, n);
+    } else {
+      for (int i = 0; i < n; i++) y[i] = f->f_ptr(x[i]);
+    }
+    for (int i = 0; i < n; i++) {
+      acc_add(&stats, x[i], y[i], sin_ref(x[i]));
+    }
+  }
+
+  pthread_mutex_lock(&job->lock);
+  acc_merge(&job->stats, &stats);
+  pthread_mutex_unlock(&job->lock);
+  gsl_rng_free(r);
+  free(x);
+  free(y);
+  free(xf);
+  free(yf);
+  return NULL;
+}
+
+// Check f on job->points random points with nthreads threads.
+static void check_function(struct job *job, int nthreads) {
+  pthread_t tid[nthreads];
+  atomic_store(&job->next, 0);
+  pthread_mutex_init(&job->lock, NULL);
+  acc_clear(&job->stats, job->f->ff_ptr != NULL ? 24 : 53);
+  for (int t = 0; t < nthreads; t++) {
+    pthread_create(&tid[t], NULL, check_chunks, job);
+  }
+  for (int t = 0; t < nthreads; t++) {
+    pthread_join(tid[t], NULL);
+  }
+  pthread_mutex_destroy(&job->lock);
+}
+
+int main(int argc, char **argv) {
+  const char *names[MAX_FUNCTIONS];
+  int nnames = 0;
+  uint64_t points = 10000000;
+  double min_x = -M_PI;
+  double max_x = M_PI;
+  int nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  int batch = 0;
+  double threshold = -1.0;
+  double x_point = 0.0;
+  int single_point = 0;
+  struct distrib dist;
+  const char *dist_spec = "flat";
+  const char *kernels = getenv("MYSIN_KERNELS");
+
+  int c;
+  while ((c = getopt(argc, argv, "A:n:m:M:D:j:bt:K:x:h")) != -1) {
+    switch (c) {
+    case 'A':
+      if (nnames == MAX_FUNCTIONS) {
+        fprintf(stderr, "At most %d functions.\n", MAX_FUNCTIONS);
+        exit(1);
+      }
+      names[nnames++] = optarg;
+      break;
+    case 'n':
+      points = (uint64_t)atof(optarg);
+      break;
+    case 'm':
+      min_x = atof(optarg);
+      break;
+    case 'M':
+      max_x = atof(optarg);
+      break;
+    case 'D':
+      dist_spec = optarg;
+      break;
+    case 'j':
+      nthreads = atoi(optarg);
+      break;
+    case 'b':
+      batch = 1;
+      break;
+    case 't':
+      threshold = atof(optarg);
+      break;
+    case 'K':
+      kernels = optarg;
+      break;
+    case 'x':
+      x_point = atof(optarg);
+      single_point = 1;
+      break;
+    case 'h':
+      fprintf(stderr, "%s\n", help_string);
+      exit(0);
+    default:
+      fprintf(stderr, "%s\n", help_string);
+      exit(1);
+    }
+  }
+  if (nnames == 0) names[nnames++] = "sin3";
+  if (load_kernels(kernels) < 0) exit(1);
+  if (dist_parse(&dist, dist_spec) != 0) exit(1);
+  if (dist.kind == DIST_FILE) points = dist.n;
+  if (nthreads < 1) nthreads = 1;
+  if (points < 1 || !(min_x < max_x)) {
+    fprintf(stderr, "Please specify a positive number of points and min < max.\n");
+    exit(1);
+  }
+
+  // -A all: every function in the table
+  struct function_item fs[MAX_FUNCTIONS];
+  int nfs = 0;
+  for (int k = 0; k < nnames; k++) {
+    if (strcmp(names[k], "all") == 0) {
+      for (int i = 0; function_lookup[i].f_ptr != NULL && nfs < MAX_FUNCTIONS; i++) {
+        if (function_lookup[i].not_sin) continue;
+        fs[nfs++] = function_lookup[i];
+      }
+      continue;
+    }
+    fs[nfs].f_name = names[k];
+    if (!find_function(&fs[nfs])) {
+      fprintf(stderr, "Unable to find function: %s\n", names[k]);
+      exit(1);
+    }
+    nfs++;
+  }
+
+  acc_init();
+  gsl_rng_env_setup();
+
+  if (single_point) {
+    dd ref = sin_ref(x_point);
+    printf("%12s\t%+-20.17e\n", "x", x_point);
+    printf("%12s\t%+-20.17e %+.3e\n", "reference", ref.hi, ref.lo);
+    for (int k = 0; k < nfs; k++) {
+      int single = fs[k].ff_ptr != NULL;
+      double x = single ? (float)x_point : x_point;
+      double y = fs[k].f_ptr(x);
+      dd exact = single ? sin_ref(x) : ref;
+      printf("%12s\t%+-20.17e %.4f ulp\n", fs[k].f_name, y,
+             ulp_error(y, exact, single ? 24 : 53));
+    }
+    exit(0);
+  }
+
+  fprintf(stderr, "%llu points, %s on [%g, %g], %d threads, seed = %lu\n",
+          (unsigned long long)points, dist_spec, min_x, max_x, nthreads,
+          gsl_rng_default_seed);
+  int failed = 0;
+  for (int k = 0; k < nfs; k++) {
+    if (!batch) {
+      fs[k].batch_ptr = NULL;
+      fs[k].fbatch_ptr = NULL;
+    }
+    struct job job = {&fs[k], &dist, min_x, max_x, points};
+    check_function(&job, nthreads);
+    printf("%s%s\n", fs[k].f_name,
+           fs[k].batch_ptr != NULL || fs[k].fbatch_ptr != NULL ? " (batch)" : "");
+    acc_print(stdout, &job.stats);
+    if (threshold >= 0.0 && !(job.stats.max <= threshold)) {
+      printf("%12s max error %.4f ulp is above %g\n", "FAIL", job.stats.max, threshold);
+      failed = 1;
+    }
+    if (fs[k].claimed_ulp > 0.0 && !(job.stats.max <= fs[k].claimed_ulp)) {
+      printf("%12s max error %.4f ulp is above its claimed %g\n", "FAIL", job.stats.max,
+             fs[k].claimed_ulp);
+      failed = 1;
+    }
+    printf("\n");
+  }
+  dist_free(&dist);
+  return failed;
+}
@@ -0,0 +1,49 @@
+// variant.h
+// The C kernels are built twice on x86-64 Linux (makefile): with -mfma,
+// so that fma() is one vfmadd, as name_fma, and without, where fma() is
+// the C library's, as name_generic.  dispatch.c binds the plain names
+// to one or the other at load time.  With KERNEL_SUFFIX defined this
+// renames the entry points of the file that includes it, before
+// mysin.h, and the calls between them, so an _fma kernel calls
+// phReduce_fma directly.  Without it, as on macOS, it does nothing.
+
+#ifndef VARIANT_H
+#define VARIANT_H
+
+#ifdef KERNEL_SUFFIX
+
+#define KERNEL_(name, suffix) name##suffix
+#define KERNEL__(name, suffix) KERNEL_(name, suffix)
+#define KERNEL(name) KERNEL__(name, KERNEL_SUFFIX)
+
+// sin5.c
+#define sin_5 KERNEL(sin_5)
+#define sin_5_64 KERNEL(sin_5_64)
+#define sin_5_256 KERNEL(sin_5_256)
+// sin_cr.c
+#define sin_cr KERNEL(sin_cr)
+#define sin_cr_fast KERNEL(sin_cr_fast)
+#define sin_cr_counts KERNEL(sin_cr_counts)
+// sin_dd.c
+#define sin_dd KERNEL(sin_dd)
+#define sin_dd_batch KERNEL(sin_dd_batch)
+// sin_approx.c
+#define sin_approx_pi2_7 KERNEL(sin_approx_pi2_7)
+#define sin_approx_pi2_9 KERNEL(sin_approx_pi2_9)
+#define sin_approx_pi2_11 KERNEL(sin_approx_pi2_11)
+#define sin_approx_pi2_13 KERNEL(sin_approx_pi2_13)
+#define sin_approx_pi2_15 KERNEL(sin_approx_pi2_15)
+#define sin_approx_pi4_7 KERNEL(sin_approx_pi4_7)
+#define sin_approx_pi4_9 KERNEL(sin_approx_pi4_9)
+#define sin_approx_pi4_11 KERNEL(sin_approx_pi4_11)
+#define sin_approx_pi4_13 KERNEL(sin_approx_pi4_13)
+// angle_reduction.c
+#define gslReduce KERNEL(gslReduce)
+#define cwReduce KERNEL(cwReduce)
+#define phReduce KERNEL(phReduce)
+#define phReduce128 KERNEL(phReduce128)
+#define two_over_pi_bits KERNEL(two_over_pi_bits)
+
+#endif
+
+#endif